@@ -9,10 +9,20 @@
 
 #include "helper.h"
 
+#include <math.h>
 #include <stdio.h>
 
 LOG_MODULE_REGISTER(bms, CONFIG_LOG_DEFAULT_LEVEL);
 
+/* BMS_IC_DATA_* flags read for each enum bms_ic_read_group */
+static const uint32_t ic_read_group_flags[BMS_IC_READ_NUM_GROUPS] = {
+    [BMS_IC_READ_CURRENT] = BMS_IC_DATA_CURRENT | BMS_IC_DATA_CHARGE,
+    [BMS_IC_READ_VOLTAGES] = BMS_IC_DATA_CELL_VOLTAGES | BMS_IC_DATA_PACK_VOLTAGES,
+    [BMS_IC_READ_TEMPERATURES] = BMS_IC_DATA_TEMPERATURES,
+    [BMS_IC_READ_BALANCING] = BMS_IC_DATA_BALANCING,
+    [BMS_IC_READ_ERROR_FLAGS] = BMS_IC_DATA_ERROR_FLAGS,
+};
+
 static const float ocv_lfp[NUM_OCV_POINTS] = {
     3.392F, 3.314F, 3.309F, 3.308F, 3.304F, 3.296F, 3.283F, 3.275F, 3.271F, 3.268F, 3.265F,
     3.264F, 3.262F, 3.252F, 3.240F, 3.226F, 3.213F, 3.190F, 3.177F, 3.132F, 2.833F,
@@ -71,6 +81,14 @@ void bms_init_config(struct bms_context *bms, enum bms_cell_type type, float nom
     bms->ic_conf.cell_ov_delay_ms = 2000;
     bms->ic_conf.cell_uv_delay_ms = 2000;
 
+    bms->ic_read_periods[BMS_IC_READ_CURRENT] =
+        IS_ENABLED(CONFIG_BMS_IC_CURRENT_MONITORING) ? CONFIG_BMS_IC_READ_PERIOD_CURRENT_MS : 0;
+    bms->ic_read_periods[BMS_IC_READ_VOLTAGES] = CONFIG_BMS_IC_READ_PERIOD_VOLTAGES_MS;
+    bms->ic_read_periods[BMS_IC_READ_TEMPERATURES] = CONFIG_BMS_IC_READ_PERIOD_TEMPERATURES_MS;
+    bms->ic_read_periods[BMS_IC_READ_BALANCING] = CONFIG_BMS_IC_READ_PERIOD_BALANCING_MS;
+    bms->ic_read_periods[BMS_IC_READ_ERROR_FLAGS] = CONFIG_BMS_IC_READ_PERIOD_ERROR_FLAGS_MS;
+    bms_ic_read_periods_validate(bms);
+
     bms->ocv_points = ocv_points;
     bms->soc_points = soc_points;
 
@@ -200,6 +218,170 @@ __weak void bms_state_machine(struct bms_context *bms)
     }
 }
 
+void bms_ic_read_periods_validate(struct bms_context *bms)
+{
+    for (int i = 0; i < BMS_IC_READ_NUM_GROUPS; i++) {
+        if (bms->ic_read_periods[i] > 0) {
+            bms->ic_read_periods[i] = CLAMP(bms->ic_read_periods[i], BMS_IC_READ_PERIOD_MIN_MS,
+                                            BMS_IC_READ_PERIOD_MAX_MS);
+        }
+    }
+}
+
+uint32_t bms_ic_read_schedule(struct bms_context *bms, int64_t now)
+{
+    uint32_t flags = 0;
+
+    for (int i = 0; i < BMS_IC_READ_NUM_GROUPS; i++) {
+        if (bms->ic_read_periods[i] == 0) {
+            continue;
+        }
+
+        /* the period may have been shortened since the due time was calculated */
+        bms->ic_read_due[i] = MIN(bms->ic_read_due[i], now + bms->ic_read_periods[i]);
+
+        if (bms->ic_read_due[i] > now) {
+            continue;
+        }
+
+        flags |= ic_read_group_flags[i];
+
+        bms->ic_read_due[i] += bms->ic_read_periods[i];
+        if (bms->ic_read_due[i] <= now) {
+            /* don't catch up on missed readings (e.g. after start-up or a changed period) */
+            bms->ic_read_due[i] = now + bms->ic_read_periods[i];
+        }
+    }
+
+    if (!IS_ENABLED(CONFIG_BMS_IC_CURRENT_MONITORING)) {
+        flags &= ~(BMS_IC_DATA_CURRENT | BMS_IC_DATA_CHARGE);
+    }
+
+    return flags;
+}
+
+uint32_t bms_ic_read_signalled(struct bms_context *bms, uint32_t flags, int64_t now)
+{
+    uint32_t due_flags = 0;
+
+    for (int i = 0; i < BMS_IC_READ_NUM_GROUPS; i++) {
+        if (bms->ic_read_periods[i] == 0 || bms->ic_read_due[i] > now
+            || (flags & ic_read_group_flags[i]) != ic_read_group_flags[i])
+        {
+            continue;
+        }
+
+        due_flags |= ic_read_group_flags[i];
+        bms->ic_read_due[i] = now + bms->ic_read_periods[i];
+    }
+
+    if (!IS_ENABLED(CONFIG_BMS_IC_CURRENT_MONITORING)) {
+        due_flags &= ~(BMS_IC_DATA_CURRENT | BMS_IC_DATA_CHARGE);
+    }
+
+    return due_flags;
+}
+
+int64_t bms_ic_read_next_due(struct bms_context *bms, int64_t now)
+{
+    int64_t next = now + CONFIG_BMS_IC_POLLING_INTERVAL_MS;
+
+    for (int i = 0; i < BMS_IC_READ_NUM_GROUPS; i++) {
+        if (bms->ic_read_periods[i] > 0) {
+            next = MIN(next, MIN(bms->ic_read_due[i], now + bms->ic_read_periods[i]));
+        }
+    }
+
+    return next;
+}
+
+#ifdef CONFIG_BMS_IC_CURRENT_SAMPLES
+
+/*
+ * Current pulses shorter than the polling period are only visible in the samples buffered by the
+ * driver, so they have to be considered as activity as well.
+ */
+static void bms_active_timestamp_update_samples(struct bms_context *bms)
+{
+    struct bms_ic_current_sample samples[8];
+    int num;
+
+    do {
+        num = bms_ic_read_current_samples(bms->ic_dev, samples, ARRAY_SIZE(samples));
+        for (int i = 0; i < num; i++) {
+            if (fabsf(samples[i].current) > bms->ic_conf.bal_idle_current) {
+                bms->active_timestamp = MAX(bms->active_timestamp, samples[i].timestamp);
+            }
+        }
+    } while (num == ARRAY_SIZE(samples));
+}
+
+#endif /* CONFIG_BMS_IC_CURRENT_SAMPLES */
+
+void bms_power_mode_update(struct bms_context *bms)
+{
+    enum bms_ic_mode mode = BMS_IC_MODE_ACTIVE;
+    int64_t now = k_uptime_get();
+    int err;
+
+#ifdef CONFIG_BMS_IC_CURRENT_SAMPLES
+    bms_active_timestamp_update_samples(bms);
+#endif
+
+    if (fabsf(bms->ic_data.current) > bms->ic_conf.bal_idle_current
+        || bms->state == BMS_STATE_SHUTDOWN)
+    {
+        bms->active_timestamp = now;
+    }
+
+    if (now - bms->active_timestamp > bms->ic_conf.bal_idle_delay * 1000LL) {
+        /*
+         * STANDBY stops the measurements and protections of the IC, so pending errors could not
+         * be cleared anymore. It also stops balancing, so only use it if the BMS was switched
+         * off without any errors and no cells are balanced.
+         */
+        mode = (bms->state == BMS_STATE_OFF && bms->ic_data.error_flags == 0
+                && bms->ic_data.balancing_status == 0)
+                   ? BMS_IC_MODE_STANDBY
+                   : BMS_IC_MODE_IDLE;
+    }
+
+    if (mode == bms->ic_mode) {
+        return;
+    }
+
+    err = bms_ic_set_mode(bms->ic_dev, mode);
+    if (err == -ENOTSUP) {
+        /* low-power modes not supported by the IC, so it just stays active */
+        return;
+    }
+    else if (err != 0) {
+        LOG_ERR("Failed to set BMS IC mode %d: %d", mode, err);
+        return;
+    }
+
+    if (bms->ic_mode == BMS_IC_MODE_STANDBY) {
+        /* MOSFETs were switched off by the IC, so start from OFF state to switch them on again */
+        bms->state = BMS_STATE_OFF;
+    }
+
+    LOG_INF("BMS IC mode %d -> %d", bms->ic_mode, mode);
+
+    if (mode == BMS_IC_MODE_ACTIVE) {
+        /* data may be outdated after a low-power mode, so refresh it before the next update */
+        uint32_t flags = BMS_IC_DATA_ALL;
+        if (!IS_ENABLED(CONFIG_BMS_IC_CURRENT_MONITORING)) {
+            flags &= ~(BMS_IC_DATA_CURRENT | BMS_IC_DATA_CHARGE);
+        }
+        err = bms_ic_read_data(bms->ic_dev, flags);
+        if (err != 0) {
+            LOG_ERR("Failed to read data after wake-up: %d", err);
+        }
+    }
+
+    bms->ic_mode = mode;
+}
+
 void bms_shutdown(struct bms_context *bms)
 {
     bms_ic_set_switches(bms->ic_dev, BMS_SWITCH_DIS, false);
@@ -8,6 +8,8 @@
 
 #include "helper.h"
 
+#include <math.h>
+
 void bms_soc_reset(struct bms_context *bms, int percent)
 {
     if (percent <= 100 && percent >= 0) {
@@ -32,19 +34,39 @@ void bms_soc_reset(struct bms_context *bms, int percent)
 
 void bms_soc_update(struct bms_context *bms)
 {
-    static float coulomb_counter_mAs = 0;
-    static int64_t last_update = 0;
-    int64_t now = k_uptime_get();
+    static float coulomb_counter_As = 0;
+    static float last_charge = 0;
+    static uint32_t last_charge_time = 0;
+    static bool charge_valid = false;
+
+    /*
+     * The charge is accumulated by the BMS IC (or its driver) independent of the rate this
+     * function is called, so only the difference since the last call is needed here.
+     *
+     * If the accumulation was restarted (IC reset, accumulator reset) or the counter wrapped
+     * around, the difference is meaningless, so the reference is only resynchronized. A restart
+     * is detected by a decreasing accumulation time, a wrap-around by a change larger than the
+     * short circuit current could cause in the elapsed time.
+     */
+    float charge_diff = bms->ic_data.charge - last_charge;
+    float charge_diff_max =
+        bms->ic_conf.dis_sc_limit * (float)(bms->ic_data.charge_time - last_charge_time + 1);
+
+    if (charge_valid && bms->ic_data.charge_time >= last_charge_time
+        && fabsf(charge_diff) <= charge_diff_max)
+    {
+        coulomb_counter_As += charge_diff;
+    }
+    last_charge = bms->ic_data.charge;
+    last_charge_time = bms->ic_data.charge_time;
+    charge_valid = true;
 
-    coulomb_counter_mAs += bms->ic_data.current * (now - last_update);
-    float soc_delta = coulomb_counter_mAs / (bms->nominal_capacity_Ah * 3.6e4F);
+    float soc_delta = coulomb_counter_As / (bms->nominal_capacity_Ah * 36.0F);
 
     if (soc_delta > 0.1F || soc_delta < -0.1F) {
         // only update SoC after significant changes to maintain higher resolution
         float soc_tmp = bms->soc + soc_delta;
         bms->soc = CLAMP(soc_tmp, 0.0F, 100.0F);
-        coulomb_counter_mAs = 0;
+        coulomb_counter_As = 0;
     }
-
-    last_update = now;
 }
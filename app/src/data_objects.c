@@ -178,6 +178,28 @@ THINGSET_ADD_ITEM_FLOAT(APP_ID_CONF, APP_ID_CONF_BAL_IDLE_CURRENT, "sBalIdleCurr
                         &bms.ic_conf.bal_idle_current, 1, THINGSET_ANY_R | THINGSET_ANY_W,
                         TS_SUBSET_NVM);
 
+// BMS IC polling periods (0 to disable polling of the data)
+
+THINGSET_ADD_ITEM_UINT32(APP_ID_CONF, APP_ID_CONF_READ_PERIOD_CURRENT, "sCurrentReadPeriod_ms",
+                         &bms.ic_read_periods[BMS_IC_READ_CURRENT],
+                         THINGSET_ANY_R | THINGSET_ANY_W, TS_SUBSET_NVM);
+
+THINGSET_ADD_ITEM_UINT32(APP_ID_CONF, APP_ID_CONF_READ_PERIOD_VOLTAGES, "sVoltagesReadPeriod_ms",
+                         &bms.ic_read_periods[BMS_IC_READ_VOLTAGES],
+                         THINGSET_ANY_R | THINGSET_ANY_W, TS_SUBSET_NVM);
+
+THINGSET_ADD_ITEM_UINT32(APP_ID_CONF, APP_ID_CONF_READ_PERIOD_TEMPS, "sTempsReadPeriod_ms",
+                         &bms.ic_read_periods[BMS_IC_READ_TEMPERATURES],
+                         THINGSET_ANY_R | THINGSET_ANY_W, TS_SUBSET_NVM);
+
+THINGSET_ADD_ITEM_UINT32(APP_ID_CONF, APP_ID_CONF_READ_PERIOD_BALANCING, "sBalancingReadPeriod_ms",
+                         &bms.ic_read_periods[BMS_IC_READ_BALANCING],
+                         THINGSET_ANY_R | THINGSET_ANY_W, TS_SUBSET_NVM);
+
+THINGSET_ADD_ITEM_UINT32(APP_ID_CONF, APP_ID_CONF_READ_PERIOD_ERROR_FLAGS,
+                         "sErrorFlagsReadPeriod_ms", &bms.ic_read_periods[BMS_IC_READ_ERROR_FLAGS],
+                         THINGSET_ANY_R | THINGSET_ANY_W, TS_SUBSET_NVM);
+
 THINGSET_ADD_FN_INT32(APP_ID_CONF, APP_ID_CONF_PRESET_NMC, "xPresetNMC", &bat_preset_nmc,
                       THINGSET_ANY_RW);
 THINGSET_ADD_ITEM_FLOAT(APP_ID_CONF_PRESET_NMC, APP_ID_CONF_PRESET_NMC_CAPACITY, "fCapacity_Ah",
@@ -208,6 +230,9 @@ THINGSET_ADD_ITEM_FLOAT(APP_ID_MEAS, APP_ID_MEAS_STACK_VOLTAGE, "rStackVoltage_V
 #ifdef CONFIG_BMS_IC_SWITCHES
 THINGSET_ADD_ITEM_FLOAT(APP_ID_MEAS, APP_ID_MEAS_PACK_CURRENT, "rPackCurrent_A",
                         &bms.ic_data.current, 2, THINGSET_ANY_R, TS_SUBSET_LIVE);
+
+THINGSET_ADD_ITEM_FLOAT(APP_ID_MEAS, APP_ID_MEAS_PACK_CURRENT_AVG, "rPackCurrentAvg_A",
+                        &bms.ic_data.current_avg, 2, THINGSET_ANY_R, 0);
 #endif
 
 THINGSET_ADD_ITEM_ARRAY(APP_ID_MEAS, APP_ID_MEAS_CELL_TEMPS, "rCellTemps_degC", &cell_temps_arr,
@@ -263,6 +288,7 @@ int data_objects_update_conf(enum thingset_callback_reason reason,
 {
     if (reason == THINGSET_CALLBACK_POST_WRITE) {
         // ToDo: Validate new settings before applying them
+        bms_ic_read_periods_validate(&bms);
 
         bms_ic_configure(bms.ic_dev, &bms.ic_conf, BMS_IC_CONF_ALL);
 
@@ -66,12 +66,18 @@
 #define APP_ID_CONF_PRESET_LTO_CAPACITY     0xA5
 #define APP_ID_CONF_OCV_POINTS              0xB0
 #define APP_ID_CONF_SOC_POINTS              0xB1
+#define APP_ID_CONF_READ_PERIOD_CURRENT     0xB8
+#define APP_ID_CONF_READ_PERIOD_VOLTAGES    0xB9
+#define APP_ID_CONF_READ_PERIOD_TEMPS       0xBA
+#define APP_ID_CONF_READ_PERIOD_BALANCING   0xBB
+#define APP_ID_CONF_READ_PERIOD_ERROR_FLAGS 0xBC
 
 /* Measurement data */
 #define APP_ID_MEAS                  0x07
 #define APP_ID_MEAS_PACK_VOLTAGE     0x71
 #define APP_ID_MEAS_STACK_VOLTAGE    0x72
 #define APP_ID_MEAS_PACK_CURRENT     0x73
+#define APP_ID_MEAS_PACK_CURRENT_AVG 0x78
 #define APP_ID_MEAS_CELL_TEMPS       0x74
 #define APP_ID_MEAS_IC_TEMP          0x75
 #define APP_ID_MEAS_MCU_TEMP         0x76
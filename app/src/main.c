@@ -22,6 +22,40 @@ struct bms_context bms = {
     .ic_dev = DEVICE_DT_GET(DT_ALIAS(bms_ic)),
 };
 
+static K_SEM_DEFINE(ic_data_sem, 0, 1);
+
+/* BMS_IC_DATA_* flags of new data signalled by the IC, which is read in the main thread */
+static atomic_t ic_data_flags;
+
+static void ic_data_callback(const struct device *dev, uint32_t flags)
+{
+    atomic_or(&ic_data_flags, flags);
+    k_sem_give(&ic_data_sem);
+}
+
+/* safeguard only, the drivers give up by themselves after a limited number of retries */
+#define IC_ACTIVATION_TIMEOUT_MS (60 * 1000)
+
+/*
+ * The driver may activate the IC asynchronously and retry in the background until the IC
+ * responds, so the application only waits for completion here.
+ */
+static int ic_wait_activated(void)
+{
+    int64_t timeout = k_uptime_get() + IC_ACTIVATION_TIMEOUT_MS;
+    struct bms_ic_status status;
+    int err;
+
+    while ((err = bms_ic_get_status(bms.ic_dev, &status)) == 0 && status.activating) {
+        if (k_uptime_get() > timeout) {
+            return -ETIMEDOUT;
+        }
+        k_sleep(K_MSEC(10));
+    }
+
+    return err == 0 ? status.last_error : err;
+}
+
 int main(void)
 {
     int err;
@@ -38,6 +72,9 @@ int main(void)
     bms_ic_assign_data(bms.ic_dev, &bms.ic_data);
 
     err = bms_ic_set_mode(bms.ic_dev, BMS_IC_MODE_ACTIVE);
+    if (err == -EINPROGRESS) {
+        err = ic_wait_activated();
+    }
     if (err != 0) {
         LOG_ERR("Failed to activate BMS IC: %d", err);
     }
@@ -56,17 +93,33 @@ int main(void)
 
     button_init();
 
-    int64_t t_start = k_uptime_get();
+    /* if supported, the IC signals new data, so that it doesn't have to be polled */
+    err = bms_ic_set_data_callback(bms.ic_dev, ic_data_callback);
+    if (err != 0 && err != -ENOSYS && err != -ENOTSUP) {
+        LOG_ERR("Failed to set BMS IC data callback: %d", err);
+    }
+
     while (true) {
-        err = bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_ALL);
-        if (err != 0) {
-            LOG_ERR("Failed to read data from BMS IC: %d", err);
+        int64_t now = k_uptime_get();
+        uint32_t read_flags;
+
+        /* signalled data is read as soon as due, remaining due groups are polled */
+        read_flags = bms_ic_read_signalled(&bms, atomic_clear(&ic_data_flags), now);
+        read_flags |= bms_ic_read_schedule(&bms, now);
+
+        if (read_flags != 0) {
+            err = bms_ic_read_data(bms.ic_dev, read_flags);
+            if (err != 0) {
+                LOG_ERR("Failed to read data from BMS IC: %d", err);
+            }
         }
 
         bms_soc_update(&bms);
 
         bms_state_machine(&bms);
 
+        bms_power_mode_update(&bms);
+
         if (button_pressed_for_3s()) {
             LOG_WRN("Button pressed for 3s: shutdown...");
             bms_shutdown(&bms);
@@ -78,8 +131,8 @@ int main(void)
             bms_ic_set_mode(bms.ic_dev, BMS_IC_MODE_OFF);
         }
 
-        t_start += CONFIG_BMS_IC_POLLING_INTERVAL_MS;
-        k_sleep(K_TIMEOUT_ABS_MS(t_start));
+        /* sleep until the next group is due or the IC signals new data */
+        k_sem_take(&ic_data_sem, K_TIMEOUT_ABS_MS(bms_ic_read_next_due(&bms, k_uptime_get())));
     }
 
     return 0;
@@ -23,29 +23,47 @@ const struct device *oled_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
 
 static bool blink_on = false;
 
+/* consistent copy of the data, as the BMS IC driver may update it while the screen is drawn */
+static struct bms_ic_data ic_data;
+
+static void oled_update_data()
+{
+    static struct bms_ic_snapshot snapshot;
+
+    if (bms_ic_get_snapshot(bms.ic_dev, &snapshot) == 0) {
+        ic_data = snapshot.data;
+    }
+    else {
+        /* snapshots not supported by the driver or no data read yet */
+        ic_data = bms.ic_data;
+    }
+}
+
 void oled_overview_screen()
 {
     static char buf[30];
     unsigned int len;
 
+    oled_update_data();
+
     cfb_framebuffer_clear(oled_dev, false);
 
     cfb_print(oled_dev, "Libre Solar", 0, 0);
     cfb_print(oled_dev, DT_PROP(DT_PATH(pcb), type), 0, 12);
 
-    len = snprintf(buf, sizeof(buf), "%.2fV", (double)bms.ic_data.total_voltage);
+    len = snprintf(buf, sizeof(buf), "%.2fV", (double)ic_data.total_voltage);
     cfb_print(oled_dev, buf, 0, 28);
 
-    len = snprintf(buf, sizeof(buf), "%.1fA", (double)bms.ic_data.current);
+    len = snprintf(buf, sizeof(buf), "%.1fA", (double)ic_data.current);
     cfb_print(oled_dev, buf, 64, 28);
 
-    len = snprintf(buf, sizeof(buf), "T:%.1f", (double)bms.ic_data.cell_temp_avg);
+    len = snprintf(buf, sizeof(buf), "T:%.1f", (double)ic_data.cell_temp_avg);
     cfb_print(oled_dev, buf, 0, 40);
 
     len = snprintf(buf, sizeof(buf), "SOC:%.0f", (double)bms.soc);
     cfb_print(oled_dev, buf, 64, 40);
 
-    len = snprintf(buf, sizeof(buf), "Err:0x%X", bms.ic_data.error_flags);
+    len = snprintf(buf, sizeof(buf), "Err:0x%X", ic_data.error_flags);
     cfb_print(oled_dev, buf, 0, 52);
 
     cfb_framebuffer_finalize(oled_dev);
@@ -56,14 +74,16 @@ void oled_cell_voltages_screen(int offset)
     static char buf[30];
     unsigned int len;
 
+    oled_update_data();
+
     cfb_framebuffer_clear(oled_dev, false);
 
     cfb_print(oled_dev, "Cell Voltages", 0, 0);
 
     for (int i = offset; i < CONFIG_BMS_IC_MAX_CELLS; i++) {
-        if (blink_on || !(bms.ic_data.balancing_status & (1 << i))) {
+        if (blink_on || !(ic_data.balancing_status & (1 << i))) {
             len =
-                snprintf(buf, sizeof(buf), "%d:%.2f", i + 1, (double)bms.ic_data.cell_voltages[i]);
+                snprintf(buf, sizeof(buf), "%d:%.2f", i + 1, (double)ic_data.cell_voltages[i]);
             cfb_print(oled_dev, buf, (i % 2 == 0) ? 0 : 64, 16 + (i / 2) * 12);
         }
     }
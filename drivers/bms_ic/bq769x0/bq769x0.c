@@ -6,8 +6,26 @@
 
 #define DT_DRV_COMPAT ti_bq769x0
 
+#include "bms_ic_balancing.h"
+#include "bms_ic_charge.h"
+#include "bms_ic_crc.h"
+#include "bms_ic_ntc.h"
 #include "bq769x0_registers.h"
 
+#ifdef CONFIG_BMS_IC_CURRENT_MONITORING
+#include "bms_ic_sw_protection.h"
+#endif
+
+#ifdef CONFIG_BMS_IC_CURRENT_SAMPLES
+#include "bms_ic_samples.h"
+#endif
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+#include "bms_ic_snapshot.h"
+#endif
+#ifdef CONFIG_BMS_IC_ASYNC
+#include "bms_ic_async.h"
+#endif
+
 #include <bms/bms_common.h>
 #include <drivers/bms_ic.h>
 
@@ -22,12 +40,26 @@
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/drivers/i2c.h>
 #include <zephyr/logging/log.h>
-#include <zephyr/sys/crc.h>
 
 LOG_MODULE_REGISTER(bms_ic_bq769x0, CONFIG_BMS_IC_LOG_LEVEL);
 
 #define BQ769X0_READ_MAX_ATTEMPTS (10)
 
+/* cell voltage, pack voltage and thermistor ADC registers are contiguous and read in one burst */
+#define BQ769X0_ADC_REGS_START BQ769X0_VC1_HI_BYTE
+#define BQ769X0_ADC_REGS_SIZE  (BQ769X0_TS3_LO_BYTE - BQ769X0_VC1_HI_BYTE + 1)
+
+#define BQ769X0_READ_MAX_BYTES BQ769X0_ADC_REGS_SIZE
+
+/* TS ADC code at the internal 3.3 V pull-up voltage (382 uV/LSB) */
+#define BQ769X0_TS_ADC_FULL_SCALE (3300.0F / 0.382F)
+
+/*
+ * Minimum time the software charge over-current protection stays tripped, same as the interval
+ * of the attempts to clear hardware over-current and short circuit errors in the alert handler.
+ */
+#define BQ769X0_CHG_OCP_RECOVERY_MS (60 * 1000)
+
 /* read-only driver configuration */
 struct bms_ic_bq769x0_config
 {
@@ -46,6 +78,8 @@ struct bms_ic_bq769x0_data
 {
     struct bms_ic_data *ic_data;
     const struct device *dev;
+    /** Serializes updates of ic_data by the work items and the application thread */
+    struct k_mutex lock;
     struct k_work_delayable alert_work;
     struct k_work_delayable balancing_work;
     /** ADC gain, factory-calibrated, read out from chip (uV/LSB) */
@@ -83,9 +117,31 @@ struct bms_ic_bq769x0_data
         uint32_t alert_mask;
     } ic_conf;
     int64_t active_timestamp;
+    /** Thermistor lookup table generated from the Beta value during initialization */
+    struct bms_ic_ntc_table ntc_table;
     union bq769x0_sys_stat sys_stat_prev;
     int error_seconds_counter;
     uint32_t balancing_status;
+    /** Set if the balancing switches were determined based on the latest cell voltages */
+    bool balancing_plan_valid;
+#ifdef CONFIG_BMS_IC_CURRENT_MONITORING
+    /** Software coulomb counter, updated with every new coulomb counter reading */
+    struct bms_ic_charge_counter charge_counter;
+    /** Charge over-current protection, evaluated for each coulomb counter reading */
+    struct bms_ic_sw_protection chg_ocp;
+#endif
+#ifdef CONFIG_BMS_IC_CURRENT_SAMPLES
+    /** Samples of each coulomb counter conversion, filled by the alert work item */
+    struct bms_ic_samples current_samples;
+#endif
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+    /** Copies of ic_data, published by read_data, the alert and the balancing work item */
+    struct bms_ic_snapshot_buf snapshot;
+#endif
+#ifdef CONFIG_BMS_IC_ASYNC
+    /** Request of bms_ic_read_data_async(), handled in the system work queue */
+    struct bms_ic_async_read async_read;
+#endif
     bool crc_enabled;
 };
 
@@ -115,7 +171,7 @@ static int bq769x0_write_byte(const struct device *dev, uint8_t reg_addr, uint8_
     };
 
     if (dev_data->crc_enabled) {
-        buf[3] = crc8_ccitt(0, buf, 3);
+        buf[3] = bms_ic_crc8(0, buf, 3);
         return i2c_write_dt(&dev_config->i2c, buf + 1, 3);
     }
     else {
@@ -128,12 +184,13 @@ static int bq769x0_read_bytes(const struct device *dev, uint8_t reg_addr, uint8_
 {
     const struct bms_ic_bq769x0_config *dev_config = dev->config;
     const struct bms_ic_bq769x0_data *dev_data = dev->data;
-    uint8_t buf[5] = {
+    uint8_t buf[1 + BQ769X0_READ_MAX_BYTES * 2] = {
         (dev_config->i2c.addr << 1) | 1U, /* target address for CRC calculation */
     };
+    bool crc_valid;
     int err;
 
-    if (num_bytes < 1 || num_bytes > 2) {
+    if (num_bytes < 1 || num_bytes > BQ769X0_READ_MAX_BYTES) {
         return -EINVAL;
     }
 
@@ -145,18 +202,19 @@ static int bq769x0_read_bytes(const struct device *dev, uint8_t reg_addr, uint8_
             }
 
             /*
-             * First CRC includes target address (incl. R/W bit) and data byte, subsequent CRCs
-             * only consider data.
+             * Each data byte is followed by a CRC. First CRC includes target address (incl.
+             * R/W bit) and data byte, subsequent CRCs only consider data.
              */
-            if (crc8_ccitt(0, buf, 2) == buf[2]) {
-                data[0] = buf[1];
-                if (num_bytes == 1) {
-                    return 0;
-                }
-                else if (crc8_ccitt(0, buf + 3, 1) == buf[4]) {
-                    data[1] = buf[3];
-                    return 0;
+            crc_valid = bms_ic_crc8(0, buf, 2) == buf[2];
+            for (size_t i = 1; i < num_bytes && crc_valid; i++) {
+                crc_valid = bms_ic_crc8(0, buf + 1 + i * 2, 1) == buf[2 + i * 2];
+            }
+
+            if (crc_valid) {
+                for (size_t i = 0; i < num_bytes; i++) {
+                    data[i] = buf[1 + i * 2];
                 }
+                return 0;
             }
         }
 
@@ -313,9 +371,16 @@ static int bq769x0_configure_chg_ocp(const struct device *dev, struct bms_ic_con
 {
     struct bms_ic_bq769x0_data *dev_data = dev->data;
 
+    k_mutex_lock(&dev_data->lock, K_FOREVER);
+
     dev_data->ic_conf.chg_oc_limit = ic_conf->chg_oc_limit;
     dev_data->ic_conf.chg_oc_delay_ms = ic_conf->chg_oc_delay_ms;
 
+    /* a latched error is reset explicitly by applying the limits again */
+    bms_ic_sw_protection_reset(&dev_data->chg_ocp);
+
+    k_mutex_unlock(&dev_data->lock);
+
     return 0;
 }
 
@@ -473,7 +538,36 @@ static int bms_ic_bq769x0_configure(const struct device *dev, struct bms_ic_conf
     return (actual_flags != 0) ? actual_flags : -ENOTSUP;
 }
 
-static int bq769x0_read_cell_voltages(const struct device *dev, struct bms_ic_data *ic_data)
+static int bq769x0_read_adc_regs(const struct device *dev, uint32_t flags, uint8_t *regs)
+{
+    const struct bms_ic_bq769x0_config *dev_config = dev->config;
+    uint8_t last_reg;
+
+    /* the burst ends at the last register actually needed for the requested data */
+    if (flags & BMS_IC_DATA_TEMPERATURES) {
+        last_reg = BQ769X0_TS1_LO_BYTE
+                   + (MIN(dev_config->num_sections, CONFIG_BMS_IC_MAX_THERMISTORS) - 1) * 2;
+    }
+    else if (flags & BMS_IC_DATA_PACK_VOLTAGES) {
+        last_reg = BQ769X0_BAT_LO_BYTE;
+    }
+    else {
+        last_reg = BQ769X0_VC1_LO_BYTE + (dev_config->num_sections * 5 - 1) * 2;
+    }
+
+    return bq769x0_read_bytes(dev, BQ769X0_ADC_REGS_START, regs,
+                              last_reg - BQ769X0_ADC_REGS_START + 1);
+}
+
+static inline uint16_t bq769x0_adc_regs_get(const uint8_t *regs, uint8_t reg_addr)
+{
+    const uint8_t *reg = regs + reg_addr - BQ769X0_ADC_REGS_START;
+
+    return (reg[0] << 8 | reg[1]) & 0x3FFF;
+}
+
+static void bq769x0_decode_cell_voltages(const struct device *dev, struct bms_ic_data *ic_data,
+                                         const uint8_t *regs)
 {
     const struct bms_ic_bq769x0_config *dev_config = dev->config;
     struct bms_ic_bq769x0_data *dev_data = dev->data;
@@ -481,15 +575,9 @@ static int bq769x0_read_cell_voltages(const struct device *dev, struct bms_ic_da
     int conn_cells = 0;
     float sum_voltages = 0;
     float v_max = 0, v_min = 10;
-    int err;
 
     for (int i = 0; i < dev_config->num_sections * 5; i++) {
-        err = bq769x0_read_word(dev, BQ769X0_VC1_HI_BYTE + i * 2, &adc_raw);
-        if (err != 0) {
-            return err;
-        }
-
-        adc_raw &= 0x3FFF;
+        adc_raw = bq769x0_adc_regs_get(regs, BQ769X0_VC1_HI_BYTE + i * 2);
         ic_data->cell_voltages[i] =
             (adc_raw * dev_data->adc_gain * 1e-3F + dev_data->adc_offset) * 1e-3F;
 
@@ -509,75 +597,48 @@ static int bq769x0_read_cell_voltages(const struct device *dev, struct bms_ic_da
     ic_data->cell_voltage_min = v_min;
     ic_data->cell_voltage_max = v_max;
 
-    return 0;
+    dev_data->balancing_plan_valid = false;
 }
 
-static int bq769x0_read_total_voltages(const struct device *dev, struct bms_ic_data *ic_data)
+static void bq769x0_decode_total_voltages(const struct device *dev, struct bms_ic_data *ic_data,
+                                          const uint8_t *regs)
 {
     struct bms_ic_bq769x0_data *dev_data = dev->data;
-    uint16_t adc_raw;
-    int err;
-
-    err = bq769x0_read_word(dev, BQ769X0_BAT_HI_BYTE, &adc_raw);
-    if (err != 0) {
-        return err;
-    }
+    uint16_t adc_raw = regs[BQ769X0_BAT_HI_BYTE - BQ769X0_ADC_REGS_START] << 8
+                       | regs[BQ769X0_BAT_LO_BYTE - BQ769X0_ADC_REGS_START];
 
     ic_data->total_voltage = (4.0F * dev_data->adc_gain * adc_raw * 1e-3F
                               + ic_data->connected_cells * dev_data->adc_offset)
                              * 1e-3F;
-
-    return 0;
 }
 
-static int bq769x0_read_temperatures(const struct device *dev, struct bms_ic_data *ic_data)
+static void bq769x0_decode_temperatures(const struct device *dev, struct bms_ic_data *ic_data,
+                                        const uint8_t *regs)
 {
     const struct bms_ic_bq769x0_config *dev_config = dev->config;
-    float tmp = 0;
+    const struct bms_ic_bq769x0_data *dev_data = dev->data;
     uint16_t adc_raw = 0;
-    int vtsx = 0;
-    unsigned long rts = 0;
-    float sum_temps = 0;
+    int32_t sum_temps = 0;
+    int16_t temp, temp_min = INT16_MAX, temp_max = INT16_MIN;
     int num_temps = 0;
-    int err;
 
     for (int i = 0; i < dev_config->num_sections && i < CONFIG_BMS_IC_MAX_THERMISTORS; i++) {
-        /* calculate R_thermistor according to bq769x0 datasheet */
-        err = bq769x0_read_word(dev, BQ769X0_TS1_HI_BYTE + i * 2, &adc_raw);
-        if (err != 0) {
-            return err;
-        }
-
-        adc_raw &= 0x3FFF;
-        vtsx = adc_raw * 0.382F;                  /* mV */
-        rts = 10000.0F * vtsx / (3300.0F - vtsx); /* Ohm */
-
         /*
-         * Temperature calculation using Beta equation
-         * - According to bq769x0 datasheet, only 10k thermistors should be used
-         * - 25°C reference temperature for Beta equation assumed
+         * The lookup table contains the Beta equation results for the 10k thermistors with
+         * internal 10k pull-up resistor recommended in the bq769x0 datasheet.
          */
-        tmp = 1.0F
-              / (1.0F / (273.15F + 25) + 1.0F / dev_config->thermistor_beta * logf(rts / 10000.0F));
-        ic_data->cell_temps[i] = tmp - 273.15F;
-        if (i == 0) {
-            ic_data->cell_temp_min = ic_data->cell_temps[i];
-            ic_data->cell_temp_max = ic_data->cell_temps[i];
-        }
-        else {
-            if (ic_data->cell_temps[i] < ic_data->cell_temp_min) {
-                ic_data->cell_temp_min = ic_data->cell_temps[i];
-            }
-            if (ic_data->cell_temps[i] > ic_data->cell_temp_max) {
-                ic_data->cell_temp_max = ic_data->cell_temps[i];
-            }
-        }
+        adc_raw = bq769x0_adc_regs_get(regs, BQ769X0_TS1_HI_BYTE + i * 2);
+        temp = bms_ic_ntc_temp(&dev_data->ntc_table, adc_raw);
+
+        ic_data->cell_temps[i] = temp * 0.1F;
+        temp_min = MIN(temp, temp_min);
+        temp_max = MAX(temp, temp_max);
         num_temps++;
-        sum_temps += ic_data->cell_temps[i];
+        sum_temps += temp;
     }
-    ic_data->cell_temp_avg = sum_temps / num_temps;
-
-    return 0;
+    ic_data->cell_temp_min = temp_min * 0.1F;
+    ic_data->cell_temp_max = temp_max * 0.1F;
+    ic_data->cell_temp_avg = sum_temps * 0.1F / num_temps;
 }
 
 #ifdef CONFIG_BMS_IC_CURRENT_MONITORING
@@ -588,8 +649,12 @@ static int bq769x0_read_current(const struct device *dev, struct bms_ic_data *ic
     struct bms_ic_bq769x0_data *dev_data = dev->data;
     uint16_t adc_raw;
 
+    /* called from both the alert work item and read_data, so the counter update is serialized */
+    k_mutex_lock(&dev_data->lock, K_FOREVER);
+
     int err = bq769x0_read_word(dev, BQ769X0_CC_HI_BYTE, &adc_raw);
     if (err != 0) {
+        k_mutex_unlock(&dev_data->lock);
         LOG_ERR("Error reading current measurement");
         return err;
     }
@@ -603,6 +668,18 @@ static int bq769x0_read_current(const struct device *dev, struct bms_ic_data *ic
 
     ic_data->current = current_mA / 1000.0;
 
+    /* the coulomb counter ADC already integrates over the 250 ms conversion time */
+    ic_data->current_avg = ic_data->current;
+
+    /*
+     * The IC has no passed charge accumulator, so the current is integrated here. This function
+     * is called for each CC_READY alert (every 250 ms), which is independent of the rate the
+     * application polls the data.
+     */
+    bms_ic_charge_counter_update(&dev_data->charge_counter, ic_data, k_uptime_get());
+
+    k_mutex_unlock(&dev_data->lock);
+
     /* reset active timestamp */
     if (fabsf(ic_data->current) > dev_data->ic_conf.bal_idle_current) {
         dev_data->active_timestamp = k_uptime_get();
@@ -611,11 +688,40 @@ static int bq769x0_read_current(const struct device *dev, struct bms_ic_data *ic
     return 0;
 }
 
+/*
+ * The bq769x0 does not support charge over-current protection in hardware, so it is checked for
+ * every new coulomb counter reading (every 250 ms) and the CHG FET is switched off immediately
+ * after the configured delay, similar to the hardware discharge over-current protection.
+ */
+static void bq769x0_check_chg_ocp(const struct device *dev, struct bms_ic_data *ic_data)
+{
+    struct bms_ic_bq769x0_data *dev_data = dev->data;
+    union bq769x0_sys_ctrl2 sys_ctrl2;
+    int err;
+
+    if (bms_ic_sw_protection_update(&dev_data->chg_ocp,
+                                    ic_data->current > dev_data->ic_conf.chg_oc_limit,
+                                    dev_data->ic_conf.chg_oc_delay_ms,
+                                    BQ769X0_CHG_OCP_RECOVERY_MS, k_uptime_get()))
+    {
+        LOG_WRN("Charge over-current: %.2f A", (double)ic_data->current);
+
+        err = bq769x0_read_byte(dev, BQ769X0_SYS_CTRL2, &sys_ctrl2.byte);
+        if (err == 0) {
+            sys_ctrl2.CHG_ON = 0;
+            err = bq769x0_write_byte(dev, BQ769X0_SYS_CTRL2, sys_ctrl2.byte);
+        }
+        if (err != 0) {
+            LOG_ERR("Failed to switch off CHG FET: %d", err);
+        }
+    }
+}
+
 #endif /* CONFIG_BMS_IC_CURRENT_MONITORING */
 
 static int bq769x0_read_error_flags(const struct device *dev, struct bms_ic_data *ic_data)
 {
-    const struct bms_ic_bq769x0_data *dev_data = dev->data;
+    struct bms_ic_bq769x0_data *dev_data = dev->data;
     union bq769x0_sys_stat sys_stat;
     uint32_t error_flags = 0;
     float hyst;
@@ -630,10 +736,12 @@ static int bq769x0_read_error_flags(const struct device *dev, struct bms_ic_data
     error_flags |= (sys_stat.SCD * UINT32_MAX) & BMS_ERR_SHORT_CIRCUIT;
     error_flags |= (sys_stat.OCD * UINT32_MAX) & BMS_ERR_DIS_OVERCURRENT;
 
-    if (ic_data->current > dev_data->ic_conf.chg_oc_limit) {
-        /* ToDo: consider ic_conf->chg_oc_delay */
+#ifdef CONFIG_BMS_IC_CURRENT_MONITORING
+    /* latched until the recovery delay passed, as the current drops to 0 after the trip */
+    if (dev_data->chg_ocp.tripped) {
         error_flags |= BMS_ERR_CHG_OVERCURRENT;
     }
+#endif
 
     hyst = (ic_data->error_flags & BMS_ERR_CHG_OVERTEMP) ? dev_data->ic_conf.temp_limit_hyst : 0;
     if (ic_data->cell_temp_max > dev_data->ic_conf.chg_ot_limit - hyst) {
@@ -669,7 +777,7 @@ static void bq769x0_alert_handler(struct k_work *work)
     struct bms_ic_data *ic_data = dev_data->ic_data;
     int err;
 
-    /* ToDo: Handle also temperature and chg errors (incl. temp hysteresis) */
+    /* ToDo: Handle also temperature errors (incl. temp hysteresis) */
 
     union bq769x0_sys_stat sys_stat;
     err = bq769x0_read_byte(dev, BQ769X0_SYS_STAT, &sys_stat.byte);
@@ -679,7 +787,25 @@ static void bq769x0_alert_handler(struct k_work *work)
 
     /* get new current reading if available */
     if (sys_stat.CC_READY == 1) {
-        bq769x0_read_current(dev, ic_data);
+        k_mutex_lock(&dev_data->lock, K_FOREVER);
+        err = bq769x0_read_current(dev, ic_data);
+        if (err == 0) {
+            bq769x0_check_chg_ocp(dev, ic_data);
+#ifdef CONFIG_BMS_IC_CURRENT_SAMPLES
+            struct bms_ic_current_sample sample = {
+                .timestamp = k_uptime_get(),
+                .current = ic_data->current,
+            };
+            if (!bms_ic_samples_put(&dev_data->current_samples, &sample)) {
+                LOG_DBG("Current sample buffer full");
+            }
+#endif
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+            bms_ic_snapshot_publish(&dev_data->snapshot, ic_data,
+                                    BMS_IC_DATA_CURRENT | BMS_IC_DATA_CHARGE);
+#endif
+        }
+        k_mutex_unlock(&dev_data->lock);
         err = bq769x0_write_byte(dev, BQ769X0_SYS_STAT, BQ769X0_SYS_STAT_CC_READY);
         if (err != 0) {
             LOG_ERR("Failed to clear CC_READY flag");
@@ -746,25 +872,35 @@ static void bq769x0_alert_handler(struct k_work *work)
     }
 }
 
-static int bms_ic_bq769x0_read_data(const struct device *dev, uint32_t flags)
+static int bq769x0_read_data_nolock(const struct device *dev, uint32_t flags)
 {
     struct bms_ic_bq769x0_data *dev_data = dev->data;
     struct bms_ic_data *ic_data = dev_data->ic_data;
+    uint8_t adc_regs[BQ769X0_ADC_REGS_SIZE];
     uint32_t actual_flags = 0;
     int err = 0;
 
+    if (flags
+        & (BMS_IC_DATA_CELL_VOLTAGES | BMS_IC_DATA_PACK_VOLTAGES | BMS_IC_DATA_TEMPERATURES))
+    {
+        err = bq769x0_read_adc_regs(dev, flags, adc_regs);
+        if (err != 0) {
+            return -EIO;
+        }
+    }
+
     if (flags & BMS_IC_DATA_CELL_VOLTAGES) {
-        err |= bq769x0_read_cell_voltages(dev, ic_data);
+        bq769x0_decode_cell_voltages(dev, ic_data, adc_regs);
         actual_flags |= BMS_IC_DATA_CELL_VOLTAGES;
     }
 
     if (flags & BMS_IC_DATA_PACK_VOLTAGES) {
-        err |= bq769x0_read_total_voltages(dev, ic_data);
+        bq769x0_decode_total_voltages(dev, ic_data, adc_regs);
         actual_flags |= BMS_IC_DATA_PACK_VOLTAGES;
     }
 
     if (flags & BMS_IC_DATA_TEMPERATURES) {
-        err |= bq769x0_read_temperatures(dev, ic_data);
+        bq769x0_decode_temperatures(dev, ic_data, adc_regs);
         actual_flags |= BMS_IC_DATA_TEMPERATURES;
     }
 
@@ -773,6 +909,11 @@ static int bms_ic_bq769x0_read_data(const struct device *dev, uint32_t flags)
         err |= bq769x0_read_current(dev, ic_data);
         actual_flags |= BMS_IC_DATA_CURRENT;
     }
+
+    if (flags & BMS_IC_DATA_CHARGE) {
+        /* charge and charge_time are kept up to date by bq769x0_read_current */
+        actual_flags |= BMS_IC_DATA_CHARGE;
+    }
 #endif /* CONFIG_BMS_IC_CURRENT_MONITORING */
 
     if (flags & BMS_IC_DATA_BALANCING) {
@@ -789,9 +930,37 @@ static int bms_ic_bq769x0_read_data(const struct device *dev, uint32_t flags)
         return -EIO;
     }
 
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+    bms_ic_snapshot_publish(&dev_data->snapshot, ic_data, actual_flags);
+#endif
+
     return (flags == actual_flags) ? 0 : -EINVAL;
 }
 
+static int bms_ic_bq769x0_read_data(const struct device *dev, uint32_t flags)
+{
+    struct bms_ic_bq769x0_data *dev_data = dev->data;
+
+    /* ic_data must not be modified by the work items while it is decoded and published */
+    k_mutex_lock(&dev_data->lock, K_FOREVER);
+    int err = bq769x0_read_data_nolock(dev, flags);
+    k_mutex_unlock(&dev_data->lock);
+
+    return err;
+}
+
+#ifdef CONFIG_BMS_IC_ASYNC
+
+static int bms_ic_bq769x0_read_data_async(const struct device *dev, uint32_t flags,
+                                          struct k_poll_signal *signal)
+{
+    struct bms_ic_bq769x0_data *dev_data = dev->data;
+
+    return bms_ic_async_read_submit(&dev_data->async_read, flags, signal);
+}
+
+#endif /* CONFIG_BMS_IC_ASYNC */
+
 static void bms_ic_bq769x0_assign_data(const struct device *dev, struct bms_ic_data *ic_data)
 {
     struct bms_ic_bq769x0_data *dev_data = dev->data;
@@ -799,6 +968,30 @@ static void bms_ic_bq769x0_assign_data(const struct device *dev, struct bms_ic_d
     dev_data->ic_data = ic_data;
 }
 
+#ifdef CONFIG_BMS_IC_CURRENT_SAMPLES
+
+static int bms_ic_bq769x0_read_current_samples(const struct device *dev,
+                                               struct bms_ic_current_sample *samples,
+                                               size_t max_samples)
+{
+    struct bms_ic_bq769x0_data *dev_data = dev->data;
+
+    return bms_ic_samples_get(&dev_data->current_samples, samples, max_samples);
+}
+
+#endif /* CONFIG_BMS_IC_CURRENT_SAMPLES */
+
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+
+static int bms_ic_bq769x0_get_snapshot(const struct device *dev, struct bms_ic_snapshot *snapshot)
+{
+    struct bms_ic_bq769x0_data *dev_data = dev->data;
+
+    return bms_ic_snapshot_get(&dev_data->snapshot, snapshot);
+}
+
+#endif /* CONFIG_BMS_IC_SNAPSHOT */
+
 #ifdef CONFIG_BMS_IC_SWITCHES
 
 static int bms_ic_bq769x0_set_switches(const struct device *dev, uint8_t switches, bool enabled)
@@ -866,61 +1059,48 @@ static void bq769x0_balancing_work_handler(struct k_work *work)
     struct bms_ic_data *ic_data = dev_data->ic_data;
     int err;
 
-    if (k_uptime_get() - dev_data->active_timestamp >= dev_data->ic_conf.bal_idle_delay
-        && ic_data->cell_voltage_max > dev_data->ic_conf.bal_cell_voltage_min
-        && (ic_data->cell_voltage_max - ic_data->cell_voltage_min)
-               > dev_data->ic_conf.bal_cell_voltage_diff)
-    {
-        ic_data->balancing_status = 0; /* current status will be set in following loop */
+    /* ic_data is shared with read_data in the application thread */
+    k_mutex_lock(&dev_data->lock, K_FOREVER);
 
-        int balancing_flags;
-        int balancing_flags_target;
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+    uint32_t balancing_status_prev = ic_data->balancing_status;
+#endif
 
-        for (int section = 0; section < dev_config->num_sections; section++) {
-            /* find cells which should be balanced and sort them by voltage descending */
-            int cell_list[5];
-            int cell_counter = 0;
-            for (int i = 0; i < 5; i++) {
-                if ((ic_data->cell_voltages[section * 5 + i] - ic_data->cell_voltage_min)
-                    > dev_data->ic_conf.bal_cell_voltage_diff)
-                {
-                    int j = cell_counter;
-                    while (j > 0
-                           && ic_data->cell_voltages[section * 5 + cell_list[j - 1]]
-                                  < ic_data->cell_voltages[section * 5 + i])
-                    {
-                        cell_list[j] = cell_list[j - 1];
-                        j--;
-                    }
-                    cell_list[j] = i;
-                    cell_counter++;
+    bool balancing_needed =
+        k_uptime_get() - dev_data->active_timestamp >= dev_data->ic_conf.bal_idle_delay
+        && ic_data->cell_voltage_max > dev_data->ic_conf.bal_cell_voltage_min
+        && (ic_data->cell_voltage_max - ic_data->cell_voltage_min)
+               > dev_data->ic_conf.bal_cell_voltage_diff;
+
+    if (balancing_needed) {
+        /* the selection only changes with new cell voltages, so it is not repeated otherwise */
+        if (!dev_data->balancing_plan_valid) {
+            float threshold =
+                ic_data->cell_voltage_min + dev_data->ic_conf.bal_cell_voltage_diff;
+            uint8_t balancing_flags;
+            bool plan_applied = true;
+
+            ic_data->balancing_status = 0; /* current status will be set in following loop */
+
+            for (int section = 0; section < dev_config->num_sections; section++) {
+                /* adjacent cells of the same section must not be balanced at the same time */
+                balancing_flags = bms_ic_balancing_plan(&ic_data->cell_voltages[section * 5], 5,
+                                                        threshold);
+
+                /* set balancing register for this section */
+                err = bq769x0_write_byte(dev, BQ769X0_CELLBAL1 + section, balancing_flags);
+                if (err == 0) {
+                    ic_data->balancing_status |= balancing_flags << section * 5;
+                    LOG_DBG("Set CELLBAL%d register to 0x%02X", section + 1, balancing_flags);
                 }
-            }
-
-            balancing_flags = 0;
-            for (int i = 0; i < cell_counter; i++) {
-                /* try to enable balancing of current cell */
-                balancing_flags_target = balancing_flags | (1 << cell_list[i]);
-
-                /* check if attempting to balance adjacent cells */
-                bool adjacent_cell_collision = ((balancing_flags_target << 1) & balancing_flags)
-                                               || ((balancing_flags << 1) & balancing_flags_target);
-
-                if (adjacent_cell_collision == false) {
-                    balancing_flags = balancing_flags_target;
+                else {
+                    plan_applied = false;
+                    LOG_ERR("Failed to set CELBAL%d register: %d", section + 1, err);
                 }
             }
 
-            ic_data->balancing_status |= balancing_flags << section * 5;
-
-            /* set balancing register for this section */
-            err = bq769x0_write_byte(dev, BQ769X0_CELLBAL1 + section, balancing_flags);
-            if (err == 0) {
-                LOG_DBG("Set CELLBAL%d register to 0x%02X", section + 1, balancing_flags);
-            }
-            else {
-                LOG_ERR("Failed to set CELBAL%d register: %d", section + 1, err);
-            }
+            /* failed writes are retried in the next run */
+            dev_data->balancing_plan_valid = plan_applied;
         }
     }
     else if (ic_data->balancing_status > 0) {
@@ -936,8 +1116,17 @@ static void bq769x0_balancing_work_handler(struct k_work *work)
         }
 
         ic_data->balancing_status = 0;
+        dev_data->balancing_plan_valid = false;
     }
 
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+    if (ic_data->balancing_status != balancing_status_prev) {
+        bms_ic_snapshot_publish(&dev_data->snapshot, ic_data, BMS_IC_DATA_BALANCING);
+    }
+#endif
+
+    k_mutex_unlock(&dev_data->lock);
+
     k_work_schedule(dwork, K_SECONDS(1));
 }
 
@@ -1035,8 +1224,16 @@ static int bq769x0_init(const struct device *dev)
 
     dev_data->dev = dev;
 
+    k_mutex_init(&dev_data->lock);
+
+    bms_ic_ntc_table_init(&dev_data->ntc_table, dev_config->thermistor_beta,
+                          BQ769X0_TS_ADC_FULL_SCALE);
+
     k_work_init_delayable(&dev_data->alert_work, bq769x0_alert_handler);
     k_work_init_delayable(&dev_data->balancing_work, bq769x0_balancing_work_handler);
+#ifdef CONFIG_BMS_IC_ASYNC
+    bms_ic_async_read_init(&dev_data->async_read, dev);
+#endif
 
     return 0;
 }
@@ -1045,11 +1242,20 @@ static const struct bms_ic_driver_api bq769x0_driver_api = {
     .configure = bms_ic_bq769x0_configure,
     .assign_data = bms_ic_bq769x0_assign_data,
     .read_data = bms_ic_bq769x0_read_data,
+#ifdef CONFIG_BMS_IC_ASYNC
+    .read_data_async = bms_ic_bq769x0_read_data_async,
+#endif
 #ifdef CONFIG_BMS_IC_SWITCHES
     .set_switches = bms_ic_bq769x0_set_switches,
 #endif
     .balance = bms_ic_bq769x0_balance,
     .set_mode = bms_ic_bq769x0_set_mode,
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+    .get_snapshot = bms_ic_bq769x0_get_snapshot,
+#endif
+#ifdef CONFIG_BMS_IC_CURRENT_SAMPLES
+    .read_current_samples = bms_ic_bq769x0_read_current_samples,
+#endif
 };
 
 #define BQ769X0_ASSERT_CURRENT_MONITORING_PROP_GREATER_ZERO(index, prop) \
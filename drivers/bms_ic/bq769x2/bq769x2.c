@@ -4,14 +4,14 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
-#define DT_DRV_COMPAT ti_bq769x2_i2c
-
+#include "bms_ic_crc.h"
 #include "bq769x2_interface.h"
 #include "bq769x2_priv.h"
 #include "bq769x2_registers.h"
 
 #include <bms/bms_common.h>
 #include <drivers/bms_ic.h>
+#include <dt-bindings/bms_ic/bq769x2.h>
 
 #include <math.h>
 #include <stdbool.h>
@@ -22,41 +22,44 @@
 #include <zephyr/device.h>
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/spi.h>
 #include <zephyr/logging/log.h>
-#include <zephyr/sys/crc.h>
+#include <zephyr/sys/byteorder.h>
 
 LOG_MODULE_REGISTER(bms_ic_bq769x2, CONFIG_BMS_IC_LOG_LEVEL);
 
+#if DT_HAS_COMPAT_STATUS_OKAY(ti_bq769x2_i2c)
+
 static int bq769x2_write_bytes_i2c(const struct device *dev, const uint8_t reg_addr,
                                    const uint8_t *data, const size_t num_bytes)
 {
     const struct bms_ic_bq769x2_config *config = dev->config;
-    uint8_t buf[10] = {
-        config->i2c.addr << 1, /* target address for CRC calculation */
+    uint8_t buf[2 + BQ769X2_DATA_BUFFER_SIZE * 2] = {
+        config->bus.i2c.addr << 1, /* target address for CRC calculation */
         reg_addr,
     };
 
-    if (num_bytes > 4 || num_bytes < 1) {
+    if (num_bytes > BQ769X2_DATA_BUFFER_SIZE || num_bytes < 1) {
         return -EINVAL;
     }
 
     if (config->crc_enabled) {
         /* first CRC includes target address and register address */
         buf[2] = data[0];
-        buf[3] = crc8_ccitt(0, buf, 3);
+        buf[3] = bms_ic_crc8(0, buf, 3);
 
         /* subsequent CRCs only include the data byte */
         for (int i = 1; i < num_bytes; i++) {
             buf[i * 2 + 2] = data[i];
-            buf[i * 2 + 3] = crc8_ccitt(0, &data[i], 1);
+            buf[i * 2 + 3] = bms_ic_crc8(0, &data[i], 1);
         }
 
-        return i2c_write_dt(&config->i2c, buf + 1, num_bytes * 2 + 1);
+        return i2c_write_dt(&config->bus.i2c, buf + 1, num_bytes * 2 + 1);
     }
     else {
         memcpy(buf + 2, data, num_bytes);
 
-        return i2c_write_dt(&config->i2c, buf + 1, num_bytes + 1);
+        return i2c_write_dt(&config->bus.i2c, buf + 1, num_bytes + 1);
     }
 }
 
@@ -79,20 +82,20 @@ static int bq769x2_read_bytes_i2c(const struct device *dev, const uint8_t reg_ad
          * for each individual byte.
          */
         uint8_t buf[3 + BQ769X2_DATA_BUFFER_SIZE * 2] = {
-            config->i2c.addr << 1,
+            config->bus.i2c.addr << 1,
             reg_addr,
-            (config->i2c.addr << 1) | 1U,
+            (config->bus.i2c.addr << 1) | 1U,
         };
         uint8_t byte, crc_read;
         int err;
 
-        err = i2c_write_read_dt(&config->i2c, &reg_addr, 1, buf + 3, num_bytes * 2);
+        err = i2c_write_read_dt(&config->bus.i2c, &reg_addr, 1, buf + 3, num_bytes * 2);
         if (err != 0) {
             return err;
         }
 
         /* check CRC of first data byte */
-        if (crc8_ccitt(0, buf, 4) == buf[4]) {
+        if (bms_ic_crc8(0, buf, 4) == buf[4]) {
             data[0] = buf[3];
         }
         else {
@@ -103,7 +106,7 @@ static int bq769x2_read_bytes_i2c(const struct device *dev, const uint8_t reg_ad
         for (int i = 1; i < num_bytes; i++) {
             byte = buf[2 * i + 3];
             crc_read = buf[2 * i + 4];
-            if (crc8_ccitt(0, &byte, 1) == crc_read) {
+            if (bms_ic_crc8(0, &byte, 1) == crc_read) {
                 data[i] = byte;
             }
             else {
@@ -114,10 +117,205 @@ static int bq769x2_read_bytes_i2c(const struct device *dev, const uint8_t reg_ad
         return 0;
     }
     else {
-        return i2c_write_read_dt(&config->i2c, &reg_addr, 1, data, num_bytes);
+        return i2c_write_read_dt(&config->bus.i2c, &reg_addr, 1, data, num_bytes);
     }
 }
 
+static bool bq769x2_bus_ready_i2c(const struct device *dev)
+{
+    const struct bms_ic_bq769x2_config *config = dev->config;
+
+    return i2c_is_ready_dt(&config->bus.i2c);
+}
+
+static int bq769x2_bus_recover_i2c(const struct device *dev)
+{
+    const struct bms_ic_bq769x2_config *config = dev->config;
+    struct bms_ic_bq769x2_data *data = dev->data;
+
+    /* clock out a potentially stuck transfer (e.g. after MCU reset in the middle of a read) */
+    k_mutex_lock(&data->lock, K_FOREVER);
+    int err = i2c_recover_bus(config->bus.i2c.bus);
+    k_mutex_unlock(&data->lock);
+
+    return err;
+}
+
+#endif /* DT_HAS_COMPAT_STATUS_OKAY(ti_bq769x2_i2c) */
+
+#if DT_HAS_COMPAT_STATUS_OKAY(ti_bq769x2_spi)
+
+/* MSB of the address byte selects a write access */
+#define BQ769X2_SPI_WRITE_BIT (0x80)
+
+/* Max. number of consecutive frames which may be answered incorrectly (e.g. device busy) */
+#define BQ769X2_SPI_MAX_RETRIES (10)
+
+/* Delay before repeating a frame which was not answered correctly */
+#define BQ769X2_SPI_RETRY_DELAY_US (50)
+
+/*
+ * Transfers a single SPI frame consisting of address byte, data byte and (optional) CRC.
+ *
+ * The device shifts out its response to the previous frame (echoed address byte and written or
+ * read data byte) while receiving the current frame.
+ *
+ * @returns 0 if successful, -EAGAIN if the CRC of the response was invalid, other negative errno
+ *          in case of bus errors
+ */
+static int bq769x2_spi_frame(const struct device *dev, const uint8_t addr, const uint8_t byte,
+                             uint8_t *resp_addr, uint8_t *resp_byte)
+{
+    const struct bms_ic_bq769x2_config *config = dev->config;
+    uint8_t tx_buf[3] = { addr, byte };
+    uint8_t rx_buf[3];
+    const size_t len = config->crc_enabled ? 3 : 2;
+    const struct spi_buf tx = { .buf = tx_buf, .len = len };
+    const struct spi_buf rx = { .buf = rx_buf, .len = len };
+    const struct spi_buf_set tx_set = { .buffers = &tx, .count = 1 };
+    const struct spi_buf_set rx_set = { .buffers = &rx, .count = 1 };
+    int err;
+
+    tx_buf[2] = bms_ic_crc8(0, tx_buf, 2);
+
+    err = spi_transceive_dt(&config->bus.spi, &tx_set, &rx_set);
+    if (err != 0) {
+        return err;
+    }
+
+    if (config->crc_enabled && bms_ic_crc8(0, rx_buf, 2) != rx_buf[2]) {
+        return -EAGAIN;
+    }
+
+    *resp_addr = rx_buf[0];
+    *resp_byte = rx_buf[1];
+
+    return 0;
+}
+
+static int bq769x2_write_bytes_spi_nolock(const struct device *dev, const uint8_t reg_addr,
+                                          const uint8_t *data, const size_t num_bytes)
+{
+    uint8_t resp_addr, resp_byte;
+    int err;
+
+    if (num_bytes > BQ769X2_DATA_BUFFER_SIZE || num_bytes < 1) {
+        return -EINVAL;
+    }
+
+    /*
+     * Each byte is repeated until the device echoes it back, as the order of the writes matters
+     * (e.g. writing the subcommand upper byte triggers its execution). The response to the first
+     * frame belongs to the previous byte, so it is never considered.
+     */
+    for (int i = 0; i < num_bytes; i++) {
+        const uint8_t addr = (reg_addr + i) | BQ769X2_SPI_WRITE_BIT;
+
+        err = bq769x2_spi_frame(dev, addr, data[i], &resp_addr, &resp_byte);
+        for (int retries = 0; err == 0 || err == -EAGAIN; retries++) {
+            if (retries >= BQ769X2_SPI_MAX_RETRIES) {
+                return -EIO;
+            }
+            else if (retries > 0) {
+                k_usleep(BQ769X2_SPI_RETRY_DELAY_US);
+            }
+
+            err = bq769x2_spi_frame(dev, addr, data[i], &resp_addr, &resp_byte);
+            if (err == 0 && resp_addr == addr && resp_byte == data[i]) {
+                break;
+            }
+        }
+        if (err != 0) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+
+static int bq769x2_read_bytes_spi_nolock(const struct device *dev, const uint8_t reg_addr,
+                                         uint8_t *data, const size_t num_bytes)
+{
+    uint32_t pending;
+    uint8_t resp_addr, resp_byte;
+    uint8_t prev = 0;
+    uint8_t next = 0;
+    bool first = true;
+    int retries = 0;
+    int err;
+
+    if (num_bytes > BQ769X2_DATA_BUFFER_SIZE || num_bytes < 1) {
+        return -EINVAL;
+    }
+
+    /*
+     * Reads are pipelined: The frame for the next byte is sent while receiving the response for
+     * the previous one, so that a block of n bytes needs only n + 1 frames. Responses are
+     * identified by the echoed address, so bytes which were not answered correctly are simply
+     * requested again. The response to the first frame belongs to a previous transfer.
+     */
+    pending = GENMASK(num_bytes - 1, 0);
+    while (pending != 0) {
+        err = bq769x2_spi_frame(dev, reg_addr + next, 0xFF, &resp_addr, &resp_byte);
+        if (err == 0 && !first && resp_addr == reg_addr + prev) {
+            data[prev] = resp_byte;
+            pending &= ~BIT(prev);
+            retries = 0;
+        }
+        else if (err != 0 && err != -EAGAIN) {
+            return err;
+        }
+        else if (!first) {
+            if (++retries > BQ769X2_SPI_MAX_RETRIES) {
+                return -EIO;
+            }
+            k_usleep(BQ769X2_SPI_RETRY_DELAY_US);
+        }
+        first = false;
+        prev = next;
+
+        /* continue with the next missing byte, wrap around to re-request skipped ones */
+        uint32_t remaining = pending & ~GENMASK(prev, 0);
+        next = find_lsb_set(remaining != 0 ? remaining : pending) - 1;
+    }
+
+    return 0;
+}
+
+/* sequences of frames belonging to one access must not be interleaved with other threads */
+static int bq769x2_write_bytes_spi(const struct device *dev, const uint8_t reg_addr,
+                                   const uint8_t *data, const size_t num_bytes)
+{
+    struct bms_ic_bq769x2_data *dev_data = dev->data;
+
+    k_mutex_lock(&dev_data->lock, K_FOREVER);
+    int err = bq769x2_write_bytes_spi_nolock(dev, reg_addr, data, num_bytes);
+    k_mutex_unlock(&dev_data->lock);
+
+    return err;
+}
+
+static int bq769x2_read_bytes_spi(const struct device *dev, const uint8_t reg_addr, uint8_t *data,
+                                  const size_t num_bytes)
+{
+    struct bms_ic_bq769x2_data *dev_data = dev->data;
+
+    k_mutex_lock(&dev_data->lock, K_FOREVER);
+    int err = bq769x2_read_bytes_spi_nolock(dev, reg_addr, data, num_bytes);
+    k_mutex_unlock(&dev_data->lock);
+
+    return err;
+}
+
+static bool bq769x2_bus_ready_spi(const struct device *dev)
+{
+    const struct bms_ic_bq769x2_config *config = dev->config;
+
+    return spi_is_ready_dt(&config->bus.spi);
+}
+
+#endif /* DT_HAS_COMPAT_STATUS_OKAY(ti_bq769x2_spi) */
+
 static int bq769x2_detect_cells(const struct device *dev)
 {
     const struct bms_ic_bq769x2_config *config = dev->config;
@@ -393,8 +591,8 @@ static int bq769x2_configure_balancing(const struct device *dev, struct bms_ic_c
     err |= bq769x2_datamem_write_i2(dev, BQ769X2_SET_CHG_CURR_TH, idle_current_threshold);
 
     if (ic_conf->auto_balancing) {
-        /* enable CB_RLX and CB_CHG */
-        err |= bq769x2_datamem_write_u1(dev, BQ769X2_SET_CBAL_CONF, 0x03);
+        /* enable CB_RLX, CB_CHG and CB_SLEEP (continue balancing in BMS_IC_MODE_IDLE) */
+        err |= bq769x2_datamem_write_u1(dev, BQ769X2_SET_CBAL_CONF, 0x07);
     }
     else {
         err |= bq769x2_datamem_write_u1(dev, BQ769X2_SET_CBAL_CONF, 0x00);
@@ -412,6 +610,21 @@ static int bq769x2_configure_balancing(const struct device *dev, struct bms_ic_c
     }
 }
 
+/*
+ * Alarms which trigger the ALERT pin: Safety alerts enabled in the SF alert masks and, if the
+ * application wants to be notified about new data, each completed measurement loop.
+ */
+static uint16_t bq769x2_alarm_mask(const struct device *dev)
+{
+    const struct bms_ic_bq769x2_data *dev_data = dev->data;
+    union bq769x2_reg_alarm alarm_mask = { 0 };
+
+    alarm_mask.MSK_SFALERT = 1;
+    alarm_mask.FULLSCAN = dev_data->data_callback != NULL;
+
+    return alarm_mask.u16;
+}
+
 static int bq769x2_configure_alerts(const struct device *dev, struct bms_ic_conf *ic_conf)
 {
     uint32_t alert_mask = 0;
@@ -451,7 +664,7 @@ static int bq769x2_configure_alerts(const struct device *dev, struct bms_ic_conf
     err |= bq769x2_datamem_write_u1(dev, BQ769X2_SET_ALARM_SF_ALERT_MASK_B, sf_alert_mask_b.byte);
 
     /* enable alarm (triggering of ALERT pin) for SF alert masks configured above */
-    err |= bq769x2_datamem_write_u2(dev, BQ769X2_SET_ALARM_DEFAULT_MASK, 0x1000);
+    err |= bq769x2_datamem_write_u2(dev, BQ769X2_SET_ALARM_DEFAULT_MASK, bq769x2_alarm_mask(dev));
 
     ic_conf->alert_mask = alert_mask;
 
@@ -512,6 +725,11 @@ static int bq769x2_init_config(const struct device *dev)
     /* Set resolution for CC2 current to 10 mA and stack/pack voltage to 10 mV */
     err |= bq769x2_datamem_write_u1(dev, BQ769X2_SET_CONF_DA, 0x06);
 
+    if (config->cc3_samples > 0) {
+        /* Number of CC2 readings averaged by the IC for the CC3 current */
+        err |= bq769x2_datamem_write_u1(dev, BQ769X2_SET_CONF_CC3_SAMPLES, config->cc3_samples);
+    }
+
     /* Disable automatic turn-on of all MOSFETs */
     err |= bq769x2_subcmd_cmd_only(dev, BQ769X2_SUBCMD_ALL_FETS_OFF);
 
@@ -529,15 +747,22 @@ static int bq769x2_init_config(const struct device *dev)
         err |= bq769x2_subcmd_cmd_only(dev, BQ769X2_SUBCMD_FET_ENABLE);
     }
 
-    /* Disable sleep mode to avoid switching off the CHG MOSFET automatically */
-    err |= bq769x2_datamem_write_u2(dev, BQ769X2_SET_CONF_POWER, 0x2882);
+    /*
+     * Disable sleep mode by default (SLEEP is only allowed in BMS_IC_MODE_IDLE) and keep REG1
+     * and REG2 powered in DEEPSLEEP (DPSLP_LDO), as they may supply the host MCU in
+     * BMS_IC_MODE_STANDBY.
+     */
+    err |= bq769x2_datamem_write_u2(dev, BQ769X2_SET_CONF_POWER, 0x2C82);
 
     /* Set ideal diode threshold to 500 mA (default was 50 mA) */
     err |= bq769x2_datamem_write_i2(dev, BQ769X2_SET_PROT_BODY_DIODE_TH, 500);
 
     if (config->auto_pdsg) {
-        /* Enable automatic pre-discharge before switching on DSG FETs */
-        err |= bq769x2_datamem_write_u1(dev, BQ769X2_SET_FET_OPTIONS, 0x1D);
+        /*
+         * Enable automatic pre-discharge before switching on DSG FETs and keep CHG FET on in
+         * SLEEP mode (SLEEPCHG)
+         */
+        err |= bq769x2_datamem_write_u1(dev, BQ769X2_SET_FET_OPTIONS, 0x1F);
 
         /*
          * Disable pre-discharge timeout (DSG FETs are only turned on based on bus voltage).
@@ -546,8 +771,11 @@ static int bq769x2_init_config(const struct device *dev)
         err |= bq769x2_datamem_write_u1(dev, BQ769X2_SET_FET_PDSG_TIMEOUT, 0);
     }
     else {
-        /* Disable automatic pre-discharge before switching on DSG FETs */
-        err |= bq769x2_datamem_write_u1(dev, BQ769X2_SET_FET_OPTIONS, 0x0D);
+        /*
+         * Disable automatic pre-discharge before switching on DSG FETs and keep CHG FET on in
+         * SLEEP mode (SLEEPCHG)
+         */
+        err |= bq769x2_datamem_write_u1(dev, BQ769X2_SET_FET_OPTIONS, 0x0F);
     }
 
     /* Configure multi-function pins (e.g. thermistor inputs) */
@@ -573,10 +801,20 @@ static int bq769x2_init_config(const struct device *dev)
 static int bms_ic_bq769x2_configure(const struct device *dev, struct bms_ic_conf *ic_conf,
                                     uint32_t flags)
 {
+    struct bms_ic_bq769x2_data *dev_data = dev->data;
     uint32_t actual_flags = 0;
     int err = 0;
 
-    err |= bq769x2_config_update_mode(dev, true);
+    if (dev_data->activating) {
+        /* the configuration would be overwritten by the activation */
+        return -EBUSY;
+    }
+
+    /* config update mode is only entered if any of the values below actually changed */
+    err = bq769x2_config_update_begin(dev);
+    if (err != 0) {
+        return -EIO;
+    }
 
     if (flags & BMS_IC_CONF_VOLTAGE_LIMITS) {
         err |= bq769x2_configure_cell_ovp(dev, ic_conf);
@@ -613,7 +851,12 @@ static int bms_ic_bq769x2_configure(const struct device *dev, struct bms_ic_conf
         actual_flags |= BMS_IC_CONF_VOLTAGE_REGS;
     }
 
-    err |= bq769x2_config_update_mode(dev, false);
+    err |= bq769x2_config_update_end(dev);
+
+    if (flags & BMS_IC_CONF_ALERTS) {
+        /* default mask is only applied after reset, so update the currently active mask too */
+        err |= bq769x2_direct_write_u2(dev, BQ769X2_CMD_ALARM_ENABLE, bq769x2_alarm_mask(dev));
+    }
 
     if (err != 0) {
         return -EIO;
@@ -622,73 +865,296 @@ static int bms_ic_bq769x2_configure(const struct device *dev, struct bms_ic_conf
     return (actual_flags != 0) ? actual_flags : -ENOTSUP;
 }
 
-static int bq769x2_read_cell_voltages(const struct device *dev, struct bms_ic_data *ic_data)
+/*
+ * Maximum number of unused bytes read in between two required direct commands so that they are
+ * still combined into a single burst read. Each additional byte costs two bytes on the bus if
+ * CRC is enabled, whereas a new transfer costs at least three bytes (target address, register
+ * address and repeated start with target address) plus the bus turnaround.
+ */
+#define BQ769X2_SCAN_MAX_GAP (4)
+
+/* cell voltages, stack, pack, CC2, 3x safety status, internal temp, FET temp and cell temps */
+#define BQ769X2_SCAN_MAX_RANGES (9 + CONFIG_BMS_IC_MAX_THERMISTORS)
+
+/* number of bytes required to mirror all direct commands */
+#define BQ769X2_DIRECT_CMD_SIZE (0x80)
+
+/**
+ * Contiguous range of direct command registers read in a single burst
+ */
+struct bq769x2_scan_range
+{
+    uint8_t addr;
+    uint8_t len;
+};
+
+/**
+ * Scan plan with the minimal set of burst reads required for the requested data
+ */
+struct bq769x2_scan_plan
+{
+    struct bq769x2_scan_range ranges[BQ769X2_SCAN_MAX_RANGES];
+    size_t num_ranges;
+};
+
+static void bq769x2_scan_add(struct bq769x2_scan_plan *plan, uint8_t addr, uint8_t len)
+{
+    int i;
+
+    if (plan->num_ranges >= ARRAY_SIZE(plan->ranges)) {
+        return;
+    }
+
+    /* insertion sort by start address (only very few elements) */
+    for (i = plan->num_ranges; i > 0 && plan->ranges[i - 1].addr > addr; i--) {
+        plan->ranges[i] = plan->ranges[i - 1];
+    }
+    plan->ranges[i].addr = addr;
+    plan->ranges[i].len = len;
+    plan->num_ranges++;
+}
+
+/*
+ * Combine sorted registers to as few contiguous ranges as possible. A single register (e.g. a
+ * 16-bit value) is never split across two ranges, so values can't be torn.
+ */
+static void bq769x2_scan_merge(struct bq769x2_scan_plan *plan)
+{
+    struct bq769x2_scan_range *merged = &plan->ranges[0];
+
+    if (plan->num_ranges == 0) {
+        return;
+    }
+
+    for (size_t i = 1; i < plan->num_ranges; i++) {
+        const struct bq769x2_scan_range *next = &plan->ranges[i];
+
+        if (next->addr <= merged->addr + merged->len + BQ769X2_SCAN_MAX_GAP
+            && next->addr + next->len - merged->addr <= BQ769X2_DATA_BUFFER_SIZE)
+        {
+            merged->len = MAX(merged->len, next->addr + next->len - merged->addr);
+        }
+        else {
+            merged++;
+            *merged = *next;
+        }
+    }
+
+    plan->num_ranges = merged - &plan->ranges[0] + 1;
+}
+
+static void bq769x2_scan_plan_create(const struct device *dev, uint32_t flags,
+                                     struct bq769x2_scan_plan *plan)
+{
+    const struct bms_ic_bq769x2_config *config = dev->config;
+
+    plan->num_ranges = 0;
+
+    if (flags & BMS_IC_DATA_CELL_VOLTAGES) {
+        bq769x2_scan_add(plan, BQ769X2_CMD_VOLTAGE_CELL_1,
+                         find_msb_set(config->used_cell_channels) * 2);
+    }
+
+    if (flags & BMS_IC_DATA_PACK_VOLTAGES) {
+        bq769x2_scan_add(plan, BQ769X2_CMD_VOLTAGE_STACK, 2);
+#ifdef CONFIG_BMS_IC_SWITCHES
+        bq769x2_scan_add(plan, BQ769X2_CMD_VOLTAGE_PACK, 2);
+#endif
+    }
+
+    if (flags & BMS_IC_DATA_TEMPERATURES) {
+        for (int i = 0; i < config->num_cell_temps; i++) {
+            bq769x2_scan_add(plan, BQ769X2_CMD_TEMP_CFETOFF + config->cell_temp_pins[i] * 2U, 2);
+        }
+        bq769x2_scan_add(plan, BQ769X2_CMD_TEMP_INT, 2);
+#ifdef CONFIG_BMS_IC_SWITCHES
+        if (config->fet_temp_pin < ARRAY_SIZE(config->pin_config)) {
+            bq769x2_scan_add(plan, BQ769X2_CMD_TEMP_CFETOFF + config->fet_temp_pin * 2U, 2);
+        }
+#endif
+    }
+
+#ifdef CONFIG_BMS_IC_CURRENT_MONITORING
+    if (flags & BMS_IC_DATA_CURRENT) {
+        bq769x2_scan_add(plan, BQ769X2_CMD_CURRENT_CC2, 2);
+    }
+#endif
+
+    if (flags & BMS_IC_DATA_ERROR_FLAGS) {
+        bq769x2_scan_add(plan, BQ769X2_CMD_SAFETY_STATUS_A, 1);
+        bq769x2_scan_add(plan, BQ769X2_CMD_SAFETY_STATUS_B, 1);
+        bq769x2_scan_add(plan, BQ769X2_CMD_SAFETY_STATUS_C, 1);
+    }
+
+    bq769x2_scan_merge(plan);
+}
+
+static int bq769x2_scan_execute(const struct device *dev, const struct bq769x2_scan_plan *plan,
+                                uint8_t *mem)
+{
+    int err;
+
+    for (size_t i = 0; i < plan->num_ranges; i++) {
+        const struct bq769x2_scan_range *range = &plan->ranges[i];
+
+        err = bq769x2_direct_read_block(dev, range->addr, &mem[range->addr], range->len);
+        if (err) {
+            return -EIO;
+        }
+    }
+
+    return 0;
+}
+
+static inline int16_t bq769x2_scan_get_i2(const uint8_t *mem, uint8_t addr)
+{
+    return (int16_t)(mem[addr] | mem[addr + 1] << 8); /* little-endian byte order */
+}
+
+static void bq769x2_update_cell_voltage_stats(struct bms_ic_data *ic_data, int num_cells)
 {
-    const struct bms_ic_bq769x2_config *dev_config = dev->config;
-    int16_t voltage = 0;
     uint8_t conn_cells = 0;
-    int cell_index = 0;
     float sum_voltages = 0;
     float v_max = 0, v_min = 10;
-    int err = 0;
+
+    for (int i = 0; i < num_cells; i++) {
+        if (ic_data->cell_voltages[i] > 0.5F) {
+            conn_cells++;
+            sum_voltages += ic_data->cell_voltages[i];
+        }
+        if (ic_data->cell_voltages[i] > v_max) {
+            v_max = ic_data->cell_voltages[i];
+        }
+        if (ic_data->cell_voltages[i] < v_min && ic_data->cell_voltages[i] > 0.5F) {
+            v_min = ic_data->cell_voltages[i];
+        }
+    }
+
+    ic_data->connected_cells = conn_cells;
+    ic_data->cell_voltage_avg = sum_voltages / conn_cells;
+    ic_data->cell_voltage_min = v_min;
+    ic_data->cell_voltage_max = v_max;
+}
+
+#ifdef CONFIG_BMS_IC_BQ769X2_SYNC_SNAPSHOT
+
+/*
+ * DASTATUS1 to DASTATUS4 contain the raw ADC counts of 4 cells each, stored as pairs of
+ * 32-bit voltage and current counts sampled at the same time.
+ */
+#define BQ769X2_DASTATUS_CELLS_PER_BLOCK 4
+
+static int bq769x2_read_cell_snapshot(const struct device *dev, struct bms_ic_data *ic_data,
+                                      bool update_current)
+{
+    const struct bms_ic_bq769x2_config *dev_config = dev->config;
+    uint8_t buf[32];
+    int64_t current_counts_sum = 0;
+    int cell_index = 0;
+    int16_t vcell_offset;
+    float cc_gain;
+    int err;
+
+    /* calibration values are usually served from the data memory cache */
+    err = bq769x2_datamem_read_i2(dev, BQ769X2_CAL_VCELL_OFFSET, &vcell_offset);
+    err |= bq769x2_datamem_read_f4(dev, BQ769X2_CAL_CURR_CC_GAIN, &cc_gain);
+    if (err != 0) {
+        return -EIO;
+    }
 
     int last_cell = find_msb_set(dev_config->used_cell_channels);
     for (int i = 0; i < last_cell; i++) {
+        int pos = i % BQ769X2_DASTATUS_CELLS_PER_BLOCK;
+
+        if (pos == 0) {
+            err = bq769x2_subcmd_read_bytes(
+                dev, BQ769X2_SUBCMD_DASTATUS1 + i / BQ769X2_DASTATUS_CELLS_PER_BLOCK, buf,
+                sizeof(buf));
+            if (err != 0) {
+                return err;
+            }
+        }
+
         if (dev_config->used_cell_channels & BIT(i)) {
             if (cell_index >= CONFIG_BMS_IC_MAX_CELLS) {
                 return -EINVAL;
             }
 
-            err |= bq769x2_direct_read_i2(dev, BQ769X2_CMD_VOLTAGE_CELL_1 + i * 2, &voltage);
-            ic_data->cell_voltages[cell_index] = voltage * 1e-3F; // unit: 1 mV
-
-            if (ic_data->cell_voltages[cell_index] > 0.5F) {
-                conn_cells++;
-                sum_voltages += ic_data->cell_voltages[cell_index];
-            }
-            if (ic_data->cell_voltages[cell_index] > v_max) {
-                v_max = ic_data->cell_voltages[cell_index];
-            }
-            if (ic_data->cell_voltages[cell_index] < v_min
-                && ic_data->cell_voltages[cell_index] > 0.5F)
-            {
-                v_min = ic_data->cell_voltages[cell_index];
+            int16_t cell_gain;
+            err = bq769x2_datamem_read_i2(dev, BQ769X2_CAL_VOLT_CELL1_GAIN + i * 2, &cell_gain);
+            if (err != 0) {
+                return -EIO;
             }
+
+            /* voltage (mV) = counts * Cell Gain / 2^24 - Cell Offset */
+            int32_t voltage_counts = sys_get_le32(&buf[pos * 8]);
+            int32_t voltage_mv = ((int64_t)voltage_counts * cell_gain >> 24) - vcell_offset;
+            ic_data->cell_voltages[cell_index] = voltage_mv * 1e-3F;
+
+            current_counts_sum += (int32_t)sys_get_le32(&buf[pos * 8 + 4]);
             cell_index++;
         }
     }
 
-    ic_data->connected_cells = conn_cells;
-    ic_data->cell_voltage_avg = sum_voltages / conn_cells;
-    ic_data->cell_voltage_min = v_min;
-    ic_data->cell_voltage_max = v_max;
+    bq769x2_update_cell_voltage_stats(ic_data, cell_index);
 
-    return err == 0 ? 0 : -EIO;
+#ifdef CONFIG_BMS_IC_CURRENT_MONITORING
+    if (update_current && cell_index > 0) {
+        /* average of the current samples taken together with the cell voltages (CC Gain: mA) */
+        ic_data->current = (float)current_counts_sum / cell_index * cc_gain * 1e-3F;
+    }
+#endif
+
+    return 0;
 }
 
-static int bq769x2_read_total_voltages(const struct device *dev, struct bms_ic_data *ic_data)
+#else
+
+static int bq769x2_decode_cell_voltages(const struct device *dev, struct bms_ic_data *ic_data,
+                                        const uint8_t *mem)
 {
+    const struct bms_ic_bq769x2_config *dev_config = dev->config;
     int16_t voltage = 0;
-    int err;
+    int cell_index = 0;
 
-    err = bq769x2_direct_read_i2(dev, BQ769X2_CMD_VOLTAGE_STACK, &voltage);
-    ic_data->total_voltage = voltage * 1e-2F; /* unit: 10 mV */
+    int last_cell = find_msb_set(dev_config->used_cell_channels);
+    for (int i = 0; i < last_cell; i++) {
+        if (dev_config->used_cell_channels & BIT(i)) {
+            if (cell_index >= CONFIG_BMS_IC_MAX_CELLS) {
+                return -EINVAL;
+            }
+
+            voltage = bq769x2_scan_get_i2(mem, BQ769X2_CMD_VOLTAGE_CELL_1 + i * 2);
+            ic_data->cell_voltages[cell_index] = voltage * 1e-3F; // unit: 1 mV
+            cell_index++;
+        }
+    }
+
+    bq769x2_update_cell_voltage_stats(ic_data, cell_index);
+
+    return 0;
+}
+
+#endif /* CONFIG_BMS_IC_BQ769X2_SYNC_SNAPSHOT */
+
+static void bq769x2_decode_total_voltages(const struct device *dev, struct bms_ic_data *ic_data,
+                                          const uint8_t *mem)
+{
+    /* unit: 10 mV */
+    ic_data->total_voltage = bq769x2_scan_get_i2(mem, BQ769X2_CMD_VOLTAGE_STACK) * 1e-2F;
 
 #ifdef CONFIG_BMS_IC_SWITCHES
-    err |= bq769x2_direct_read_i2(dev, BQ769X2_CMD_VOLTAGE_PACK, &voltage);
-    ic_data->external_voltage = voltage * 1e-2F; /* unit: 10 mV */
+    ic_data->external_voltage = bq769x2_scan_get_i2(mem, BQ769X2_CMD_VOLTAGE_PACK) * 1e-2F;
 #endif
-
-    return err == 0 ? 0 : -EIO;
 }
 
-static int bq769x2_read_temperatures(const struct device *dev, struct bms_ic_data *ic_data)
+static void bq769x2_decode_temperatures(const struct device *dev, struct bms_ic_data *ic_data,
+                                        const uint8_t *mem)
 {
     const struct bms_ic_bq769x2_config *config = dev->config;
     int16_t temp = 0; /* unit: 0.1 K */
     float sum_temps = 0;
     float temp_max = -1000, temp_min = 1000;
-    int err = 0;
 
     for (int i = 0; i < config->num_cell_temps; i++) {
         /*
@@ -696,8 +1162,7 @@ static int bq769x2_read_temperatures(const struct device *dev, struct bms_ic_dat
          * two bytes. CFETOFF is the first temperature sensor register, which is used to
          * calculate the offsets for the following sensors.
          */
-        err |= bq769x2_direct_read_i2(
-            dev, BQ769X2_CMD_TEMP_CFETOFF + config->cell_temp_pins[i] * 2U, &temp);
+        temp = bq769x2_scan_get_i2(mem, BQ769X2_CMD_TEMP_CFETOFF + config->cell_temp_pins[i] * 2U);
         ic_data->cell_temps[i] = (temp * 0.1F) - 273.15F;
         sum_temps += ic_data->cell_temps[i];
         if (ic_data->cell_temps[i] > temp_max) {
@@ -713,30 +1178,63 @@ static int bq769x2_read_temperatures(const struct device *dev, struct bms_ic_dat
     ic_data->cell_temp_min = temp_min;
     ic_data->cell_temp_max = temp_max;
 
-    err |= bq769x2_direct_read_i2(dev, BQ769X2_CMD_TEMP_INT, &temp);
+    temp = bq769x2_scan_get_i2(mem, BQ769X2_CMD_TEMP_INT);
     ic_data->ic_temp = (temp * 0.1F) - 273.15F;
 
 #ifdef CONFIG_BMS_IC_SWITCHES
     /* Read MOSFET temperature if a pin was defined in Devicetree */
     if (config->fet_temp_pin < ARRAY_SIZE(config->pin_config)) {
-        err |= bq769x2_direct_read_i2(dev, BQ769X2_CMD_TEMP_CFETOFF + config->fet_temp_pin * 2U,
-                                      &temp);
+        temp = bq769x2_scan_get_i2(mem, BQ769X2_CMD_TEMP_CFETOFF + config->fet_temp_pin * 2U);
         ic_data->mosfet_temp = (temp * 0.1F) - 273.15F;
     }
 #endif
-
-    return err == 0 ? 0 : -EIO;
 }
 
 #ifdef CONFIG_BMS_IC_CURRENT_MONITORING
 
-static int bq769x2_read_current(const struct device *dev, struct bms_ic_data *ic_data)
+static void bq769x2_decode_current(const struct device *dev, struct bms_ic_data *ic_data,
+                                   const uint8_t *mem)
+{
+    ic_data->current = bq769x2_scan_get_i2(mem, BQ769X2_CMD_CURRENT_CC2) * 1e-2F;
+}
+
+static int bq769x2_read_current_avg(const struct device *dev, struct bms_ic_data *ic_data)
 {
-    int16_t current = 0;
+    const struct bms_ic_bq769x2_config *dev_config = dev->config;
+
+    if (dev_config->cc3_samples == 0) {
+        ic_data->current_avg = ic_data->current;
+        return 0;
+    }
+
+    /* CC3 current (average of the last CC3 Samples CC2 readings) is only exposed in DASTATUS5 */
+    uint8_t buf[22];
     int err;
 
-    err = bq769x2_direct_read_i2(dev, BQ769X2_CMD_CURRENT_CC2, &current);
-    ic_data->current = current * 1e-2F;
+    err = bq769x2_subcmd_read_bytes(dev, BQ769X2_SUBCMD_DASTATUS5, buf, sizeof(buf));
+    if (!err) {
+        /* same userA unit as CC2 current (10 mA as configured in DA config) */
+        ic_data->current_avg = (int16_t)sys_get_le16(&buf[20]) * 1e-2F;
+    }
+
+    return err;
+}
+
+static int bq769x2_read_charge(const struct device *dev, struct bms_ic_data *ic_data)
+{
+    /* DASTATUS6 starts with accumulated charge (integer and fraction) and accumulation time */
+    uint8_t buf[12];
+    int err;
+
+    err = bq769x2_subcmd_read_bytes(dev, BQ769X2_SUBCMD_DASTATUS6, buf, sizeof(buf));
+    if (!err) {
+        /* charge is given in userAh (10 mAh as configured in DA config), fraction in 1/2^32 */
+        int32_t charge_int = sys_get_le32(&buf[0]);
+        uint32_t charge_frac = sys_get_le32(&buf[4]);
+
+        ic_data->charge = (charge_int + charge_frac * 2.3283064e-10F) * 36.0F;
+        ic_data->charge_time = sys_get_le32(&buf[8]);
+    }
 
     return err;
 }
@@ -757,25 +1255,22 @@ static int bq769x2_read_balancing(const struct device *dev, struct bms_ic_data *
     return err;
 }
 
-static int bq769x2_read_error_flags(const struct device *dev, struct bms_ic_data *ic_data)
+static void bq769x2_decode_error_flags(const struct device *dev, struct bms_ic_data *ic_data,
+                                       const uint8_t *mem)
 {
     union bq769x2_reg_safety_a safety_status_a;
     union bq769x2_reg_safety_b safety_status_b;
     union bq769x2_reg_safety_c safety_status_c;
     uint32_t error_flags = 0;
-    int err;
 
     /*
      * Safety alert: immediately set if a fault condition occured
      * Safety fault (status registers): only set if alert persists for specified time
      */
 
-    err = bq769x2_direct_read_u1(dev, BQ769X2_CMD_SAFETY_STATUS_A, &safety_status_a.byte);
-    err |= bq769x2_direct_read_u1(dev, BQ769X2_CMD_SAFETY_STATUS_B, &safety_status_b.byte);
-    err |= bq769x2_direct_read_u1(dev, BQ769X2_CMD_SAFETY_STATUS_C, &safety_status_c.byte);
-    if (err) {
-        return -EIO;
-    }
+    safety_status_a.byte = mem[BQ769X2_CMD_SAFETY_STATUS_A];
+    safety_status_b.byte = mem[BQ769X2_CMD_SAFETY_STATUS_B];
+    safety_status_c.byte = mem[BQ769X2_CMD_SAFETY_STATUS_C];
 
     error_flags |= (safety_status_a.CUV * UINT32_MAX) & BMS_ERR_CELL_UNDERVOLTAGE;
     error_flags |= (safety_status_a.COV * UINT32_MAX) & BMS_ERR_CELL_OVERVOLTAGE;
@@ -790,14 +1285,14 @@ static int bq769x2_read_error_flags(const struct device *dev, struct bms_ic_data
     error_flags |= (safety_status_b.OTF * UINT32_MAX) & BMS_ERR_FET_OVERTEMP;
 
     ic_data->error_flags = error_flags;
-
-    return 0;
 }
 
-static int bms_ic_bq769x2_read_data(const struct device *dev, uint32_t flags)
+static int bq769x2_read_data_nolock(const struct device *dev, uint32_t flags)
 {
     struct bms_ic_bq769x2_data *dev_data = dev->data;
     struct bms_ic_data *ic_data = dev_data->ic_data;
+    struct bq769x2_scan_plan plan;
+    uint8_t mem[BQ769X2_DIRECT_CMD_SIZE];
     uint32_t actual_flags = 0;
     int err = 0;
 
@@ -805,26 +1300,54 @@ static int bms_ic_bq769x2_read_data(const struct device *dev, uint32_t flags)
         return -ENOMEM;
     }
 
+    uint32_t scan_flags = flags;
+
+#ifdef CONFIG_BMS_IC_BQ769X2_SYNC_SNAPSHOT
+    /* cell voltages and the matching current are obtained from the DASTATUS snapshot */
+    if (flags & BMS_IC_DATA_CELL_VOLTAGES) {
+        scan_flags &= ~(BMS_IC_DATA_CELL_VOLTAGES | BMS_IC_DATA_CURRENT);
+    }
+#endif
+
+    /* all required direct commands are read with as few burst reads as possible */
+    bq769x2_scan_plan_create(dev, scan_flags, &plan);
+    err = bq769x2_scan_execute(dev, &plan, mem);
+    if (err != 0) {
+        return -EIO;
+    }
+
     if (flags & BMS_IC_DATA_CELL_VOLTAGES) {
-        err |= bq769x2_read_cell_voltages(dev, ic_data);
+#ifdef CONFIG_BMS_IC_BQ769X2_SYNC_SNAPSHOT
+        err |= bq769x2_read_cell_snapshot(dev, ic_data, flags & BMS_IC_DATA_CURRENT);
+#else
+        err |= bq769x2_decode_cell_voltages(dev, ic_data, mem);
+#endif
         actual_flags |= BMS_IC_DATA_CELL_VOLTAGES;
     }
 
     if (flags & BMS_IC_DATA_PACK_VOLTAGES) {
-        err |= bq769x2_read_total_voltages(dev, ic_data);
+        bq769x2_decode_total_voltages(dev, ic_data, mem);
         actual_flags |= BMS_IC_DATA_PACK_VOLTAGES;
     }
 
     if (flags & BMS_IC_DATA_TEMPERATURES) {
-        err |= bq769x2_read_temperatures(dev, ic_data);
+        bq769x2_decode_temperatures(dev, ic_data, mem);
         actual_flags |= BMS_IC_DATA_TEMPERATURES;
     }
 
 #ifdef CONFIG_BMS_IC_CURRENT_MONITORING
     if (flags & BMS_IC_DATA_CURRENT) {
-        err |= bq769x2_read_current(dev, ic_data);
+        if (scan_flags & BMS_IC_DATA_CURRENT) {
+            bq769x2_decode_current(dev, ic_data, mem);
+        }
+        err |= bq769x2_read_current_avg(dev, ic_data);
         actual_flags |= BMS_IC_DATA_CURRENT;
     }
+
+    if (flags & BMS_IC_DATA_CHARGE) {
+        err |= bq769x2_read_charge(dev, ic_data);
+        actual_flags |= BMS_IC_DATA_CHARGE;
+    }
 #endif /* CONFIG_BMS_IC_CURRENT_MONITORING */
 
     if (flags & BMS_IC_DATA_BALANCING) {
@@ -833,7 +1356,7 @@ static int bms_ic_bq769x2_read_data(const struct device *dev, uint32_t flags)
     }
 
     if (flags & BMS_IC_DATA_ERROR_FLAGS) {
-        err |= bq769x2_read_error_flags(dev, ic_data);
+        bq769x2_decode_error_flags(dev, ic_data, mem);
         actual_flags |= BMS_IC_DATA_ERROR_FLAGS;
     }
 
@@ -841,9 +1364,37 @@ static int bms_ic_bq769x2_read_data(const struct device *dev, uint32_t flags)
         return -EIO;
     }
 
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+    bms_ic_snapshot_publish(&dev_data->snapshot, ic_data, actual_flags);
+#endif
+
     return (flags == actual_flags) ? 0 : -EINVAL;
 }
 
+static int bms_ic_bq769x2_read_data(const struct device *dev, uint32_t flags)
+{
+    struct bms_ic_bq769x2_data *dev_data = dev->data;
+
+    /* ic_data must not be modified by a concurrent read while it is decoded and published */
+    k_mutex_lock(&dev_data->lock, K_FOREVER);
+    int err = bq769x2_read_data_nolock(dev, flags);
+    k_mutex_unlock(&dev_data->lock);
+
+    return err;
+}
+
+#ifdef CONFIG_BMS_IC_ASYNC
+
+static int bms_ic_bq769x2_read_data_async(const struct device *dev, uint32_t flags,
+                                          struct k_poll_signal *signal)
+{
+    struct bms_ic_bq769x2_data *dev_data = dev->data;
+
+    return bms_ic_async_read_submit(&dev_data->async_read, flags, signal);
+}
+
+#endif /* CONFIG_BMS_IC_ASYNC */
+
 static void bms_ic_bq769x2_assign_data(const struct device *dev, struct bms_ic_data *ic_data)
 {
     struct bms_ic_bq769x2_data *dev_data = dev->data;
@@ -907,54 +1458,267 @@ static int bms_ic_bq769x2_balance(const struct device *dev, uint32_t cells)
     return bq769x2_subcmd_write_u2(dev, BQ769X2_SUBCMD_CB_ACTIVE_CELLS, (uint16_t)cells);
 }
 
+/*
+ * The bq769x2 asserts the ALERT pin as long as any enabled bit in ALARM_STATUS is set (see
+ * bq769x2_alarm_mask).
+ */
+static void bq769x2_alert_isr(const struct device *port, struct gpio_callback *cb,
+                              gpio_port_pins_t pins)
+{
+    struct bms_ic_bq769x2_data *dev_data =
+        CONTAINER_OF(cb, struct bms_ic_bq769x2_data, alert_cb);
+
+    k_work_reschedule(&dev_data->alert_work, K_NO_WAIT);
+}
+
+static void bq769x2_alert_handler(struct k_work *work)
+{
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct bms_ic_bq769x2_data *dev_data =
+        CONTAINER_OF(dwork, struct bms_ic_bq769x2_data, alert_work);
+    const struct device *dev = dev_data->dev;
+    const struct bms_ic_bq769x2_config *config = dev->config;
+    bms_ic_data_callback_t callback = dev_data->data_callback;
+    union bq769x2_reg_alarm alarm_status;
+    uint32_t flags = 0;
+    int err;
+
+    err = bq769x2_direct_read_u2(dev, BQ769X2_CMD_ALARM_STATUS, &alarm_status.u16);
+    if (err != 0) {
+        LOG_ERR("Failed to read alarm status");
+        return;
+    }
+
+    /* latched bits are cleared by writing 1 to them */
+    err = bq769x2_direct_write_u2(dev, BQ769X2_CMD_ALARM_STATUS, alarm_status.u16);
+    if (err != 0) {
+        LOG_ERR("Failed to clear alarm status");
+    }
+
+    if (alarm_status.FULLSCAN) {
+        flags |= BMS_IC_DATA_ALL;
+    }
+    if (alarm_status.ADSCAN) {
+        flags |= BMS_IC_DATA_CELL_VOLTAGES | BMS_IC_DATA_PACK_VOLTAGES | BMS_IC_DATA_CURRENT;
+    }
+    if (alarm_status.MSK_SFALERT || alarm_status.SSA || alarm_status.SSBC) {
+        flags |= BMS_IC_DATA_ERROR_FLAGS;
+    }
+
+    if (!IS_ENABLED(CONFIG_BMS_IC_CURRENT_MONITORING)) {
+        flags &= ~(BMS_IC_DATA_CURRENT | BMS_IC_DATA_CHARGE);
+    }
+
+    /*
+     * The data is not read here, as the application owns the assigned bms_ic_data object and
+     * reads it from its own thread without further locking.
+     */
+    if (flags != 0 && callback != NULL) {
+        callback(dev, flags);
+    }
+
+    /*
+     * The pin is still asserted if a new alarm occured in the meantime or if an alarm condition
+     * persists, so no further edge will be detected. Check again later.
+     */
+    if (gpio_pin_get_dt(&config->alert_gpio) > 0) {
+        k_work_reschedule(dwork, K_MSEC(CONFIG_BMS_IC_POLLING_INTERVAL_MS));
+    }
+}
+
+static int bms_ic_bq769x2_set_data_callback(const struct device *dev,
+                                            bms_ic_data_callback_t callback)
+{
+    const struct bms_ic_bq769x2_config *config = dev->config;
+    struct bms_ic_bq769x2_data *dev_data = dev->data;
+    int err;
+
+    bool alert_pin = dev_data->alert_enabled
+                     && (config->pin_config[BQ769X2_PIN_ALERT] & BQ769X2_PIN_FXN_MASK)
+                            == BQ769X2_PIN_FXN_ALERT;
+
+    if (callback != NULL && !alert_pin) {
+        /* the callback would never be called without the ALERT pin function */
+        return -ENOTSUP;
+    }
+
+    dev_data->data_callback = callback;
+
+    /* completed measurements only trigger the ALERT pin if the data is requested */
+    err = bq769x2_direct_write_u2(dev, BQ769X2_CMD_ALARM_ENABLE, bq769x2_alarm_mask(dev));
+
+    return err == 0 ? 0 : -EIO;
+}
+
+/* first retry is quick, as communication errors after MCU reset are usually just glitches */
+#define BQ769X2_ACTIVATION_RETRY_MIN_MS (10)
+#define BQ769X2_ACTIVATION_RETRY_MAX_MS (10000)
+
 static int bq769x2_activate(const struct device *dev)
 {
-    uint16_t device_number;
     int err = 0;
 
-    while (bq769x2_subcmd_read_u2(dev, BQ769X2_SUBCMD_DEVICE_NUMBER, &device_number) != 0) {
-        /*
-         * For some boards (e.g. with ESP32-C3) the first attempt to configure the IC may fail
-         * because of glitches in the I2C communication after MCU reset. Retry multiple times.
-         */
-        LOG_ERR("Failed to read from BMS IC with error %d, retrying in 10s", err);
-        k_sleep(K_MSEC(10000));
-    }
+    /* the device may have been reset, so the data memory shadow can't be trusted anymore */
+    bq769x2_datamem_cache_invalidate(dev);
 
     err |= bq769x2_config_update_mode(dev, true);
 
-    err |= bq769x2_init_config(dev);
-    if (err != 0) {
+    /* data memory writes are combined into blocks and sent at the end of the configuration */
+    if (bq769x2_config_update_begin(dev) != 0) {
         return -EIO;
     }
 
-    err |= bq769x2_config_update_mode(dev, false);
+    err |= bq769x2_init_config(dev);
 
-    LOG_INF("Activated BMS IC 0x%x", device_number);
+    err |= bq769x2_config_update_end(dev);
 
     return err == 0 ? 0 : -EIO;
 }
 
+static void bq769x2_activation_handler(struct k_work *work)
+{
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct bms_ic_bq769x2_data *dev_data =
+        CONTAINER_OF(dwork, struct bms_ic_bq769x2_data, activation_work);
+    const struct device *dev = dev_data->dev;
+    const struct bms_ic_bq769x2_config *config = dev->config;
+    uint16_t device_number;
+    int err;
+
+    err = bq769x2_subcmd_read_u2(dev, BQ769X2_SUBCMD_DEVICE_NUMBER, &device_number);
+    if (err == 0) {
+        err = bq769x2_activate(dev);
+        if (err == 0) {
+            LOG_INF("Activated BMS IC 0x%x", device_number);
+            dev_data->mode = BMS_IC_MODE_ACTIVE;
+            dev_data->activation_error = 0;
+            dev_data->activating = false;
+            return;
+        }
+        LOG_WRN("Failed to configure BMS IC 0x%x: %d", device_number, err);
+    }
+
+    dev_data->activation_attempts++;
+    dev_data->activation_error = err;
+
+    if (dev_data->activation_attempts >= CONFIG_BMS_IC_BQ769X2_ACTIVATION_ATTEMPTS) {
+        LOG_ERR("BMS IC activation failed after %u attempts with error %d",
+                dev_data->activation_attempts, err);
+        dev_data->activating = false;
+        return;
+    }
+
+    /*
+     * For some boards (e.g. with ESP32-C3) the first attempt to communicate with the IC may fail
+     * because of glitches in the I2C communication after MCU reset. Try to recover the bus and
+     * retry with exponential backoff.
+     */
+    LOG_WRN("Activation of BMS IC failed with error %d, retrying in %u ms", err,
+            dev_data->activation_retry_ms);
+
+    if (config->bus_recover != NULL) {
+        config->bus_recover(dev);
+    }
+
+    k_work_reschedule(dwork, K_MSEC(dev_data->activation_retry_ms));
+    dev_data->activation_retry_ms =
+        MIN(dev_data->activation_retry_ms * 2, BQ769X2_ACTIVATION_RETRY_MAX_MS);
+}
+
 static int bms_ic_bq769x2_set_mode(const struct device *dev, enum bms_ic_mode mode)
 {
+    struct bms_ic_bq769x2_data *dev_data = dev->data;
+    int err = 0;
+
+    if (dev_data->activating) {
+        return mode == BMS_IC_MODE_ACTIVE ? -EINPROGRESS : -EBUSY;
+    }
+
+    /* leave low-power modes before entering a different one */
+    if (dev_data->mode == BMS_IC_MODE_STANDBY && mode != BMS_IC_MODE_STANDBY) {
+        err |= bq769x2_subcmd_cmd_only(dev, BQ769X2_SUBCMD_EXIT_DEEPSLEEP);
+    }
+    else if (dev_data->mode == BMS_IC_MODE_IDLE && mode != BMS_IC_MODE_IDLE) {
+        err |= bq769x2_subcmd_cmd_only(dev, BQ769X2_SUBCMD_SLEEP_DISABLE);
+    }
+
     switch (mode) {
         case BMS_IC_MODE_ACTIVE:
-            return bq769x2_activate(dev);
+            if (dev_data->mode != BMS_IC_MODE_IDLE && dev_data->mode != BMS_IC_MODE_STANDBY) {
+                /* not woken up from low-power mode, so (re-)initialize the IC asynchronously */
+                dev_data->activation_retry_ms = BQ769X2_ACTIVATION_RETRY_MIN_MS;
+                dev_data->activation_attempts = 0;
+                dev_data->activation_error = 0;
+                dev_data->activating = true;
+                k_work_reschedule(&dev_data->activation_work, K_NO_WAIT);
+                return -EINPROGRESS;
+            }
+            break;
+        case BMS_IC_MODE_IDLE:
+            /*
+             * SLEEP is entered by the IC as soon as the current is below Sleep Current and left
+             * automatically if the current rises again. FETs stay on (see SLEEPCHG setting).
+             */
+            err |= bq769x2_subcmd_cmd_only(dev, BQ769X2_SUBCMD_SLEEP_ENABLE);
+            break;
+        case BMS_IC_MODE_STANDBY:
+            /* DEEPSLEEP subcommand has to be sent twice within 4 s to take effect */
+            err |= bq769x2_subcmd_cmd_only(dev, BQ769X2_SUBCMD_DEEPSLEEP);
+            err |= bq769x2_subcmd_cmd_only(dev, BQ769X2_SUBCMD_DEEPSLEEP);
+            break;
         case BMS_IC_MODE_OFF:
-            return bq769x2_subcmd_cmd_only(dev, BQ769X2_SUBCMD_SHUTDOWN);
+            err |= bq769x2_subcmd_cmd_only(dev, BQ769X2_SUBCMD_SHUTDOWN);
+            break;
         default:
             return -ENOTSUP;
     }
+
+    if (err != 0) {
+        return -EIO;
+    }
+
+    dev_data->mode = mode;
+
+    return 0;
 }
 
 static int bq769x2_init(const struct device *dev)
 {
     const struct bms_ic_bq769x2_config *config = dev->config;
+    struct bms_ic_bq769x2_data *dev_data = dev->data;
+    int err;
 
-    if (!i2c_is_ready_dt(&config->i2c)) {
-        LOG_ERR("I2C device not ready");
+    if (!config->bus_ready(dev)) {
+        LOG_ERR("Bus device not ready");
         return -ENODEV;
     }
+    dev_data->dev = dev;
+
+    k_mutex_init(&dev_data->lock);
+    k_work_init_delayable(&dev_data->alert_work, bq769x2_alert_handler);
+    k_work_init_delayable(&dev_data->activation_work, bq769x2_activation_handler);
+#ifdef CONFIG_BMS_IC_ASYNC
+    bms_ic_async_read_init(&dev_data->async_read, dev);
+#endif
+
+    /* the alert is optional, as the application can still poll the data */
+    err = gpio_is_ready_dt(&config->alert_gpio) ? 0 : -ENODEV;
+    if (err == 0) {
+        err = gpio_pin_configure_dt(&config->alert_gpio, GPIO_INPUT);
+    }
+    if (err == 0) {
+        gpio_init_callback(&dev_data->alert_cb, bq769x2_alert_isr, BIT(config->alert_gpio.pin));
+        err = gpio_add_callback_dt(&config->alert_gpio, &dev_data->alert_cb);
+    }
+    if (err == 0) {
+        err = gpio_pin_interrupt_configure_dt(&config->alert_gpio, GPIO_INT_EDGE_TO_ACTIVE);
+    }
+    if (err == 0) {
+        dev_data->alert_enabled = true;
+    }
+    else {
+        LOG_WRN("Failed to configure alert GPIO (%d), data has to be polled", err);
+    }
 
     /* Datasheet: Start-up time max. 4.3 ms */
     k_sleep(K_TIMEOUT_ABS_MS(5));
@@ -962,15 +1726,47 @@ static int bq769x2_init(const struct device *dev)
     return 0;
 }
 
+static int bms_ic_bq769x2_get_status(const struct device *dev, struct bms_ic_status *status)
+{
+    struct bms_ic_bq769x2_data *dev_data = dev->data;
+
+    status->mode = dev_data->mode;
+    status->activating = dev_data->activating;
+    status->activation_attempts = dev_data->activation_attempts;
+    status->last_error = dev_data->activation_error;
+    status->skipped_transfers = dev_data->skipped_transfers;
+
+    return 0;
+}
+
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+
+static int bms_ic_bq769x2_get_snapshot(const struct device *dev, struct bms_ic_snapshot *snapshot)
+{
+    struct bms_ic_bq769x2_data *dev_data = dev->data;
+
+    return bms_ic_snapshot_get(&dev_data->snapshot, snapshot);
+}
+
+#endif /* CONFIG_BMS_IC_SNAPSHOT */
+
 static const struct bms_ic_driver_api bq769x2_driver_api = {
     .configure = bms_ic_bq769x2_configure,
     .assign_data = bms_ic_bq769x2_assign_data,
     .read_data = bms_ic_bq769x2_read_data,
+#ifdef CONFIG_BMS_IC_ASYNC
+    .read_data_async = bms_ic_bq769x2_read_data_async,
+#endif
 #ifdef CONFIG_BMS_IC_SWITCHES
     .set_switches = bms_ic_bq769x2_set_switches,
 #endif
     .balance = bms_ic_bq769x2_balance,
     .set_mode = bms_ic_bq769x2_set_mode,
+    .set_data_callback = bms_ic_bq769x2_set_data_callback,
+    .get_status = bms_ic_bq769x2_get_status,
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+    .get_snapshot = bms_ic_bq769x2_get_snapshot,
+#endif
 };
 
 #define BQ769X2_ASSERT_CURRENT_MONITORING_PROP_GREATER_ZERO(index, prop) \
@@ -979,12 +1775,25 @@ static const struct bms_ic_driver_api bq769x2_driver_api = {
                  "Devicetree properties shunt-resistor-uohm and board-max-current " \
                  "must be greater than 0 for CONFIG_BMS_IC_CURRENT_MONITORING=y")
 
-#define BQ769X2_INIT(index) \
-    static struct bms_ic_bq769x2_data bq769x2_data_##index = { 0 }; \
+#define BQ769X2_SPI_OPERATION (SPI_WORD_SET(8) | SPI_TRANSFER_MSB | SPI_OP_MODE_MASTER)
+
+#define BQ769X2_CONFIG_I2C(index) \
+    .bus.i2c = I2C_DT_SPEC_INST_GET(index), .write_bytes = bq769x2_write_bytes_i2c, \
+    .read_bytes = bq769x2_read_bytes_i2c, .bus_ready = bq769x2_bus_ready_i2c, \
+    .bus_recover = bq769x2_bus_recover_i2c,
+
+#define BQ769X2_CONFIG_SPI(index) \
+    .bus.spi = SPI_DT_SPEC_INST_GET(index, BQ769X2_SPI_OPERATION, 0), \
+    .write_bytes = bq769x2_write_bytes_spi, .read_bytes = bq769x2_read_bytes_spi, \
+    .bus_ready = bq769x2_bus_ready_spi,
+
+#define BQ769X2_INIT(index, bus) \
+    static struct bms_ic_bq769x2_data bq769x2_data_##bus##_##index = { 0 }; \
     BQ769X2_ASSERT_CURRENT_MONITORING_PROP_GREATER_ZERO(index, shunt_resistor_uohm); \
     BQ769X2_ASSERT_CURRENT_MONITORING_PROP_GREATER_ZERO(index, board_max_current); \
-    static const struct bms_ic_bq769x2_config bq769x2_config_##index = {                   \
-        .i2c = I2C_DT_SPEC_INST_GET(index),                                                \
+    static const struct bms_ic_bq769x2_config bq769x2_config_##bus##_##index = {           \
+        COND_CODE_1(DT_INST_ON_BUS(index, spi), (BQ769X2_CONFIG_SPI(index)),               \
+                    (BQ769X2_CONFIG_I2C(index)))                                           \
         .alert_gpio = GPIO_DT_SPEC_INST_GET(index, alert_gpios),                           \
         .shunt_resistor_uohm = DT_INST_PROP_OR(index, shunt_resistor_uohm, 1000),          \
         .board_max_current = DT_INST_PROP_OR(index, board_max_current, 0),                 \
@@ -1009,11 +1818,16 @@ static const struct bms_ic_driver_api bq769x2_driver_api = {
         .reg0_config = DT_INST_PROP(index, reg0_config),                                   \
         .reg12_config = DT_INST_PROP(index, reg12_config),                                 \
         .max_balanced_cells = DT_INST_PROP(index, max_balanced_cells),                     \
-        .write_bytes = bq769x2_write_bytes_i2c,                                            \
-        .read_bytes = bq769x2_read_bytes_i2c,                                              \
+        .cc3_samples = DT_INST_PROP(index, cc3_samples),                                   \
     }; \
-    DEVICE_DT_INST_DEFINE(index, &bq769x2_init, NULL, &bq769x2_data_##index, \
-                          &bq769x2_config_##index, POST_KERNEL, CONFIG_BMS_IC_INIT_PRIORITY, \
-                          &bq769x2_driver_api);
+    DEVICE_DT_INST_DEFINE(index, &bq769x2_init, NULL, &bq769x2_data_##bus##_##index, \
+                          &bq769x2_config_##bus##_##index, POST_KERNEL, \
+                          CONFIG_BMS_IC_INIT_PRIORITY, &bq769x2_driver_api);
+
+#define DT_DRV_COMPAT ti_bq769x2_i2c
+DT_INST_FOREACH_STATUS_OKAY_VARGS(BQ769X2_INIT, i2c)
+#undef DT_DRV_COMPAT
 
-DT_INST_FOREACH_STATUS_OKAY(BQ769X2_INIT)
+#define DT_DRV_COMPAT ti_bq769x2_spi
+DT_INST_FOREACH_STATUS_OKAY_VARGS(BQ769X2_INIT, spi)
+#undef DT_DRV_COMPAT
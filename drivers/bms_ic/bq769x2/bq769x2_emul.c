@@ -4,14 +4,15 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
-#define DT_DRV_COMPAT ti_bq769x2_i2c
-
+#include "bms_ic_crc.h"
 #include "bq769x2_registers.h"
 
 #include <zephyr/device.h>
 #include <zephyr/drivers/emul.h>
 #include <zephyr/drivers/i2c.h>
 #include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/drivers/spi.h>
+#include <zephyr/drivers/spi_emul.h>
 #include <zephyr/logging/log.h>
 
 LOG_MODULE_REGISTER(bq769x2_emul, CONFIG_BMS_IC_LOG_LEVEL);
@@ -30,12 +31,21 @@ struct bq769x0_emul_data
     uint8_t direct_mem[BQ_DIRECT_MEM_SIZE];
     /* Memory of bq769x2 for subcommands / data */
     uint8_t data_mem[BQ_DATA_MEM_SIZE];
+    /* DASTATUS1 to DASTATUS7 return 32 bytes each, so they would overlap in data_mem */
+    uint8_t dastatus[7][BQ769X2_DATA_BUFFER_SIZE];
     uint32_t cur_reg;
+    /* SPI response to the previous frame (address, data and CRC) */
+    uint8_t spi_resp[3];
+    /* all bus transfers fail if set (e.g. IC not powered) */
+    bool bus_error;
+    /* reads starting at this direct command address fail (negative to disable) */
+    int read_error_addr;
 };
 
 struct bq769x0_emul_cfg
 {
     uint16_t addr;
+    bool crc_enabled;
 };
 
 uint8_t bq769x2_emul_get_direct_mem(const struct emul *em, uint8_t addr)
@@ -66,6 +76,32 @@ void bq769x2_emul_set_data_mem(const struct emul *em, uint16_t addr, uint8_t byt
     em_data->data_mem[addr] = byte;
 }
 
+void bq769x2_emul_set_dastatus(const struct emul *em, uint16_t subcmd, const uint8_t *data,
+                               size_t len)
+{
+    struct bq769x0_emul_data *em_data = em->data;
+
+    __ASSERT(subcmd >= BQ769X2_SUBCMD_DASTATUS1 && subcmd <= BQ769X2_SUBCMD_DASTATUS7,
+             "invalid subcmd: 0x%x", subcmd);
+
+    memcpy(em_data->dastatus[subcmd - BQ769X2_SUBCMD_DASTATUS1], data,
+           MIN(len, BQ769X2_DATA_BUFFER_SIZE));
+}
+
+void bq769x2_emul_set_bus_error(const struct emul *em, bool error)
+{
+    struct bq769x0_emul_data *em_data = em->data;
+
+    em_data->bus_error = error;
+}
+
+void bq769x2_emul_set_read_error(const struct emul *em, int addr)
+{
+    struct bq769x0_emul_data *em_data = em->data;
+
+    em_data->read_error_addr = addr;
+}
+
 /*
  * This function emulates the actual behavior of the chip for some subcmds, if required for the unit
  * tests.
@@ -79,11 +115,23 @@ static void bq769x0_emul_process_subcmd(const struct emul *em, const uint16_t da
     switch (data_addr) {
         case BQ769X2_SUBCMD_SET_CFGUPDATE:
             k_usleep(2000);
-            em_data->direct_mem[BQ769X2_CMD_BATTERY_STATUS] = 0x01;
+            em_data->direct_mem[BQ769X2_CMD_BATTERY_STATUS] |= BIT(0);
             break;
         case BQ769X2_SUBCMD_EXIT_CFGUPDATE:
             k_usleep(1000);
-            em_data->direct_mem[BQ769X2_CMD_BATTERY_STATUS] = 0x00;
+            em_data->direct_mem[BQ769X2_CMD_BATTERY_STATUS] &= ~BIT(0);
+            break;
+        case BQ769X2_SUBCMD_SLEEP_ENABLE:
+            em_data->direct_mem[BQ769X2_CMD_BATTERY_STATUS] |= BIT(2);
+            break;
+        case BQ769X2_SUBCMD_SLEEP_DISABLE:
+            em_data->direct_mem[BQ769X2_CMD_BATTERY_STATUS] &= ~BIT(2);
+            break;
+        case BQ769X2_SUBCMD_DEEPSLEEP:
+            em_data->direct_mem[BQ769X2_CMD_CONTROL_STATUS] |= BIT(2);
+            break;
+        case BQ769X2_SUBCMD_EXIT_DEEPSLEEP:
+            em_data->direct_mem[BQ769X2_CMD_CONTROL_STATUS] &= ~BIT(2);
             break;
     };
 }
@@ -97,9 +145,22 @@ static int bq769x0_emul_write_bytes(const struct emul *em, const uint8_t reg_add
         return -EINVAL;
     }
 
-    memcpy(&em_data->direct_mem[reg_addr], data, num_bytes);
+    for (size_t i = 0; i < num_bytes; i++) {
+        const size_t addr = reg_addr + i;
+
+        if (addr == BQ769X2_CMD_ALARM_STATUS || addr == BQ769X2_CMD_ALARM_STATUS + 1) {
+            /* alarm status bits are cleared by writing 1 */
+            em_data->direct_mem[addr] &= ~data[i];
+        }
+        else {
+            em_data->direct_mem[addr] = data[i];
+        }
+    }
+
+    /* SPI writes single bytes, so execution is triggered by the relevant register, not the first */
+    const size_t last_reg = reg_addr + num_bytes - 1;
 
-    if (reg_addr == BQ769X2_SUBCMD_DATA_CHECKSUM || reg_addr == BQ769X2_SUBCMD_DATA_LENGTH) {
+    if (reg_addr <= BQ769X2_SUBCMD_DATA_LENGTH && last_reg >= BQ769X2_SUBCMD_DATA_LENGTH) {
         /* writing to BQ769X2_SUBCMD_DATA_LENGTH starts execution of a subcommand */
 
         uint16_t data_addr = (em_data->direct_mem[BQ769X2_CMD_SUBCMD_UPPER] << 8)
@@ -114,8 +175,8 @@ static int bq769x0_emul_write_bytes(const struct emul *em, const uint8_t reg_add
         memcpy(&em_data->data_mem[data_addr], &em_data->direct_mem[BQ769X2_SUBCMD_DATA_START],
                subcmd_bytes);
     }
-    else if (reg_addr == BQ769X2_CMD_SUBCMD_LOWER && num_bytes == 2) {
-        /* writing to SUBCMD register initiates a subcmd / data read */
+    else if (reg_addr <= BQ769X2_CMD_SUBCMD_UPPER && last_reg >= BQ769X2_CMD_SUBCMD_UPPER) {
+        /* writing to upper byte of SUBCMD register initiates a subcmd / data read */
 
         uint16_t data_addr = (em_data->direct_mem[BQ769X2_CMD_SUBCMD_UPPER] << 8)
                              + em_data->direct_mem[BQ769X2_CMD_SUBCMD_LOWER];
@@ -126,17 +187,31 @@ static int bq769x0_emul_write_bytes(const struct emul *em, const uint8_t reg_add
 
         bq769x0_emul_process_subcmd(em, data_addr);
 
-        memcpy(&em_data->direct_mem[BQ769X2_SUBCMD_DATA_START], &em_data->data_mem[data_addr], 4);
+        /*
+         * The device returns 32 bytes for data memory reads and the DASTATUSx subcommands. For
+         * other subcommands always assume maximum data type length of 4 bytes.
+         */
+        const uint8_t *src = &em_data->data_mem[data_addr];
+        uint8_t data_length = 4;
+        if (BQ769X2_IS_DATA_MEM_REG_ADDR(data_addr)) {
+            data_length = MIN(BQ769X2_DATA_BUFFER_SIZE, BQ769X2_DATA_MEM_END - data_addr);
+        }
+        else if (data_addr >= BQ769X2_SUBCMD_DASTATUS1 && data_addr <= BQ769X2_SUBCMD_DASTATUS7) {
+            src = em_data->dastatus[data_addr - BQ769X2_SUBCMD_DASTATUS1];
+            data_length = BQ769X2_DATA_BUFFER_SIZE;
+        }
+
+        memcpy(&em_data->direct_mem[BQ769X2_SUBCMD_DATA_START], src, data_length);
 
-        // always assume maximum data type length of 4 bytes
         uint8_t checksum = em_data->direct_mem[BQ769X2_CMD_SUBCMD_UPPER]
                            + em_data->direct_mem[BQ769X2_CMD_SUBCMD_LOWER];
-        for (int i = 0; i < 4; i++) {
+        for (int i = 0; i < data_length; i++) {
             checksum += em_data->direct_mem[BQ769X2_SUBCMD_DATA_START + i];
         }
         checksum = ~checksum;
 
-        em_data->direct_mem[BQ769X2_SUBCMD_DATA_LENGTH] = 4 + BQ769X2_SUBCMD_OVERHEAD_BYTES;
+        em_data->direct_mem[BQ769X2_SUBCMD_DATA_LENGTH] =
+            data_length + BQ769X2_SUBCMD_OVERHEAD_BYTES;
         em_data->direct_mem[BQ769X2_SUBCMD_DATA_CHECKSUM] = checksum;
     }
 
@@ -157,9 +232,17 @@ static int bq769x0_emul_read_bytes(const struct emul *em, const uint8_t reg_addr
     return 0;
 }
 
+#if DT_HAS_COMPAT_STATUS_OKAY(ti_bq769x2_i2c)
+
 static int bq769x0_emul_transfer(const struct emul *em, struct i2c_msg *msgs, int num_msgs,
                                  int addr)
 {
+    struct bq769x0_emul_data *em_data = em->data;
+
+    if (em_data->bus_error) {
+        return -EIO;
+    }
+
     if (num_msgs < 1) {
         LOG_ERR("Invalid number of messages: %d", num_msgs);
         return -EIO;
@@ -183,6 +266,9 @@ static int bq769x0_emul_transfer(const struct emul *em, struct i2c_msg *msgs, in
     }
     else if (num_msgs > 1) {
         /* write-read operation with reg_addr in the first msg */
+        if (reg_addr == em_data->read_error_addr) {
+            return -EIO;
+        }
         bq769x0_emul_read_bytes(em, reg_addr, msgs[1].buf, msgs[1].len);
     }
     else {
@@ -193,21 +279,95 @@ static int bq769x0_emul_transfer(const struct emul *em, struct i2c_msg *msgs, in
     return 0;
 }
 
-static struct i2c_emul_api bus_api = {
+static struct i2c_emul_api bus_api_i2c = {
     .transfer = bq769x0_emul_transfer,
 };
 
+#endif /* DT_HAS_COMPAT_STATUS_OKAY(ti_bq769x2_i2c) */
+
+#if DT_HAS_COMPAT_STATUS_OKAY(ti_bq769x2_spi)
+
+/*
+ * Each SPI frame accesses a single register and consists of the address byte (MSB set for
+ * writes), the data byte and an optional CRC. The response to a frame is shifted out during the
+ * subsequent frame.
+ */
+static int bq769x2_emul_spi_io(const struct emul *em, const struct spi_config *config,
+                               const struct spi_buf_set *tx_bufs, const struct spi_buf_set *rx_bufs)
+{
+    struct bq769x0_emul_data *em_data = em->data;
+    const struct bq769x0_emul_cfg *em_cfg = em->cfg;
+    const size_t frame_len = em_cfg->crc_enabled ? 3 : 2;
+
+    if (em_data->bus_error) {
+        return -EIO;
+    }
+
+    if (tx_bufs == NULL || rx_bufs == NULL || tx_bufs->count != 1 || rx_bufs->count != 1
+        || tx_bufs->buffers[0].len != frame_len || rx_bufs->buffers[0].len != frame_len)
+    {
+        LOG_ERR("Unexpected SPI transfer");
+        return -EIO;
+    }
+
+    const uint8_t *tx = tx_bufs->buffers[0].buf;
+    uint8_t *rx = rx_bufs->buffers[0].buf;
+
+    memcpy(rx, em_data->spi_resp, frame_len);
+
+    if (em_cfg->crc_enabled && bms_ic_crc8(0, tx, 2) != tx[2]) {
+        LOG_WRN("Invalid CRC in SPI frame");
+        memset(em_data->spi_resp, 0xFF, sizeof(em_data->spi_resp));
+        return 0;
+    }
+
+    em_data->spi_resp[0] = tx[0];
+    if (tx[0] & 0x80) {
+        bq769x0_emul_write_bytes(em, tx[0] & 0x7F, &tx[1], 1);
+        em_data->spi_resp[1] = tx[1];
+    }
+    else if (tx[0] == em_data->read_error_addr) {
+        return -EIO;
+    }
+    else {
+        bq769x0_emul_read_bytes(em, tx[0], &em_data->spi_resp[1], 1);
+    }
+    em_data->spi_resp[2] = bms_ic_crc8(0, em_data->spi_resp, 2);
+
+    return 0;
+}
+
+static struct spi_emul_api bus_api_spi = {
+    .io = bq769x2_emul_spi_io,
+};
+
+#endif /* DT_HAS_COMPAT_STATUS_OKAY(ti_bq769x2_spi) */
+
 static int bq769x2_emul_init(const struct emul *target, const struct device *parent)
 {
+    struct bq769x0_emul_data *em_data = target->data;
+
+    /* response of the device before the first SPI frame was received */
+    memset(em_data->spi_resp, 0xFF, sizeof(em_data->spi_resp));
+
+    em_data->read_error_addr = -1;
+
     return 0;
 }
 
-#define BQ769X2_EMUL(n) \
-    static struct bq769x0_emul_data bq769x0_emul_data_##n; \
-    static const struct bq769x0_emul_cfg bq769x0_emul_cfg_##n = { \
+#define BQ769X2_EMUL(n, bus) \
+    static struct bq769x0_emul_data bq769x0_emul_data_##bus##_##n; \
+    static const struct bq769x0_emul_cfg bq769x0_emul_cfg_##bus##_##n = { \
         .addr = DT_INST_REG_ADDR(n), \
+        .crc_enabled = DT_INST_PROP(n, crc_enabled), \
     }; \
-    EMUL_DT_INST_DEFINE(n, bq769x2_emul_init, &bq769x0_emul_data_##n, &bq769x0_emul_cfg_##n, \
-                        &bus_api, NULL)
+    EMUL_DT_INST_DEFINE(n, bq769x2_emul_init, &bq769x0_emul_data_##bus##_##n, \
+                        &bq769x0_emul_cfg_##bus##_##n, &bus_api_##bus, NULL)
+
+#define DT_DRV_COMPAT ti_bq769x2_i2c
+DT_INST_FOREACH_STATUS_OKAY_VARGS(BQ769X2_EMUL, i2c)
+#undef DT_DRV_COMPAT
 
-DT_INST_FOREACH_STATUS_OKAY(BQ769X2_EMUL)
+#define DT_DRV_COMPAT ti_bq769x2_spi
+DT_INST_FOREACH_STATUS_OKAY_VARGS(BQ769X2_EMUL, spi)
+#undef DT_DRV_COMPAT
@@ -11,6 +11,8 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 uint8_t bq769x2_emul_get_direct_mem(const struct emul *em, uint8_t addr);
@@ -21,6 +23,13 @@ uint8_t bq769x2_emul_get_data_mem(const struct emul *em, uint16_t addr);
 
 void bq769x2_emul_set_data_mem(const struct emul *em, uint16_t addr, uint8_t byte);
 
+void bq769x2_emul_set_dastatus(const struct emul *em, uint16_t subcmd, const uint8_t *data,
+                               size_t len);
+
+void bq769x2_emul_set_bus_error(const struct emul *em, bool error);
+
+void bq769x2_emul_set_read_error(const struct emul *em, int addr);
+
 #ifdef __cplusplus
 }
 #endif
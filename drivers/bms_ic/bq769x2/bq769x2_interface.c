@@ -13,15 +13,167 @@
 #include <zephyr/drivers/i2c.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
 
 LOG_MODULE_REGISTER(bq769x2_if, CONFIG_BMS_IC_LOG_LEVEL);
 
 /*
- * Specification of max. attempts and delays for reading data from the device. Worst case command
- * IROM_SIG() takes approx 8500 us to complete according to reference manual Table 9-2.
+ * Expected execution times of subcommands according to reference manual Table 9-2. Only
+ * subcommands taking significantly longer than BQ769X2_SUBCMD_DEFAULT_TIME_US are listed.
  */
-#define BQ769X2_READ_MAX_ATTEMPTS (100)
-#define BQ769X2_READ_DELAY_US     (100)
+static const struct
+{
+    uint16_t subcmd;
+    uint16_t time_us;
+} bq769x2_subcmd_times[] = {
+    { BQ769X2_SUBCMD_IROM_SIG, 8500 },
+    { BQ769X2_SUBCMD_SET_CFGUPDATE, 2000 },
+    { BQ769X2_SUBCMD_EXIT_CFGUPDATE, 1000 },
+};
+
+/* Other subcommands and data memory accesses need at least 50 us to complete */
+#define BQ769X2_SUBCMD_DEFAULT_TIME_US (50)
+
+/* Fixed delay after subcommand and data memory writes, as their completion can't be polled */
+#define BQ769X2_WRITE_DELAY_US (200)
+
+/* Max. additional time to wait for completion after the expected execution time has passed */
+#define BQ769X2_SUBCMD_TIMEOUT_US (10000)
+
+/* Initial and max. delay between two status reads while polling (exponential backoff) */
+#define BQ769X2_POLL_DELAY_MIN_US (50)
+#define BQ769X2_POLL_DELAY_MAX_US (1000)
+
+/* Initial estimate for the duration of a status read (2 bytes via I2C at 400 kHz) */
+#define BQ769X2_BUS_ROUND_TRIP_US (120)
+
+/**
+ * Check function for completion polling
+ *
+ * @returns 0 if completed, -EBUSY if still in progress, other negative errno in case of errors
+ */
+typedef int (*bq769x2_poll_check_t)(const struct device *dev, uint16_t arg);
+
+static uint32_t bq769x2_subcmd_time_us(const uint16_t subcmd)
+{
+    for (int i = 0; i < ARRAY_SIZE(bq769x2_subcmd_times); i++) {
+        if (bq769x2_subcmd_times[i].subcmd == subcmd) {
+            return bq769x2_subcmd_times[i].time_us;
+        }
+    }
+
+    return BQ769X2_SUBCMD_DEFAULT_TIME_US;
+}
+
+/*
+ * Waits for completion of an operation with the given expected execution time.
+ *
+ * The task only sleeps if the expected time (or the current backoff delay) is longer than a
+ * status read via the bus, as polling is less expensive than a sleep in this case.
+ */
+static int bq769x2_wait_complete(const struct device *dev, const uint32_t expected_us,
+                                 bq769x2_poll_check_t check, const uint16_t arg)
+{
+    struct bms_ic_bq769x2_data *data = dev->data;
+    uint32_t delay_us = BQ769X2_POLL_DELAY_MIN_US;
+    uint32_t start = k_cycle_get_32();
+    uint32_t elapsed_us;
+    int err;
+
+    if (data->bus_round_trip_us == 0) {
+        data->bus_round_trip_us = BQ769X2_BUS_ROUND_TRIP_US;
+    }
+
+    if (expected_us > data->bus_round_trip_us) {
+        k_usleep(expected_us);
+    }
+
+    while (true) {
+        uint32_t poll_start = k_cycle_get_32();
+        err = check(dev, arg);
+        uint32_t poll_end = k_cycle_get_32();
+
+        /* moving average of the measured bus round-trip time */
+        data->bus_round_trip_us =
+            (data->bus_round_trip_us * 3 + k_cyc_to_us_floor32(poll_end - poll_start)) / 4;
+        data->wait_stats.polls++;
+
+        elapsed_us = k_cyc_to_us_floor32(poll_end - start);
+        if (err != -EBUSY) {
+            break;
+        }
+        else if (elapsed_us > expected_us + BQ769X2_SUBCMD_TIMEOUT_US) {
+            data->wait_stats.timeouts++;
+            return -ETIMEDOUT;
+        }
+
+        if (delay_us > data->bus_round_trip_us) {
+            k_usleep(delay_us);
+        }
+        delay_us = MIN(delay_us * 2, BQ769X2_POLL_DELAY_MAX_US);
+    }
+
+    if (err == 0) {
+        data->wait_stats.count++;
+        data->wait_stats.total_us += elapsed_us;
+        data->wait_stats.max_us = MAX(data->wait_stats.max_us, elapsed_us);
+    }
+
+    return err;
+}
+
+/* subcommands finished processing as soon as they are read back from the subcmd registers */
+static int bq769x2_check_subcmd_echo(const struct device *dev, const uint16_t subcmd)
+{
+    const struct bms_ic_bq769x2_config *config = dev->config;
+    uint8_t buf[2];
+
+    int err = config->read_bytes(dev, BQ769X2_CMD_SUBCMD_LOWER, buf, 2);
+    if (err) {
+        return err;
+    }
+
+    return sys_get_le16(buf) == subcmd ? 0 : -EBUSY;
+}
+
+static int bq769x2_check_cfgupdate(const struct device *dev, const uint16_t config_update)
+{
+    union bq769x2_reg_bat_status bat_status;
+
+    int err = bq769x2_direct_read_u2(dev, BQ769X2_CMD_BATTERY_STATUS, &bat_status.u16);
+    if (err) {
+        return err;
+    }
+
+    return bat_status.CFGUPDATE == config_update ? 0 : -EBUSY;
+}
+
+static int bq769x2_subcmd_wait(const struct device *dev, const uint16_t subcmd)
+{
+    int err = bq769x2_wait_complete(dev, bq769x2_subcmd_time_us(subcmd),
+                                    bq769x2_check_subcmd_echo, subcmd);
+    if (err == -ETIMEDOUT) {
+        LOG_ERR("Subcmd 0x%04X not completed within %d us", subcmd,
+                bq769x2_subcmd_time_us(subcmd) + BQ769X2_SUBCMD_TIMEOUT_US);
+        return -EIO;
+    }
+
+    return err;
+}
+
+void bq769x2_wait_stats_get(const struct device *dev, struct bq769x2_wait_stats *stats)
+{
+    const struct bms_ic_bq769x2_data *data = dev->data;
+
+    *stats = data->wait_stats;
+}
+
+void bq769x2_wait_stats_reset(const struct device *dev)
+{
+    struct bms_ic_bq769x2_data *data = dev->data;
+
+    memset(&data->wait_stats, 0, sizeof(data->wait_stats));
+}
 
 int bq769x2_direct_read_u1(const struct device *dev, const uint8_t reg_addr, uint8_t *value)
 {
@@ -63,8 +215,40 @@ int bq769x2_direct_read_i2(const struct device *dev, const uint8_t reg_addr, int
     return err;
 }
 
-static int bq769x2_data_read(const struct device *dev, const uint16_t addr, uint8_t *bytes,
-                             const size_t num_bytes)
+int bq769x2_direct_read_block(const struct device *dev, const uint8_t reg_addr, uint8_t *data,
+                              const size_t num_bytes)
+{
+    const struct bms_ic_bq769x2_config *config = dev->config;
+
+    if (num_bytes > BQ769X2_DATA_BUFFER_SIZE || num_bytes < 1) {
+        return -EINVAL;
+    }
+
+    int err = config->read_bytes(dev, reg_addr, data, num_bytes);
+    if (err) {
+        LOG_ERR("direct_read_block failed");
+    }
+
+    return err;
+}
+
+int bq769x2_direct_write_u2(const struct device *dev, const uint8_t reg_addr, const uint16_t value)
+{
+    const struct bms_ic_bq769x2_config *config = dev->config;
+    uint8_t buf[2];
+
+    sys_put_le16(value, buf);
+
+    int err = config->write_bytes(dev, reg_addr, buf, 2);
+    if (err) {
+        LOG_ERR("direct_write_u2 failed");
+    }
+
+    return err;
+}
+
+static int bq769x2_data_read_nolock(const struct device *dev, const uint16_t addr, uint8_t *bytes,
+                                    const size_t num_bytes, size_t *num_read)
 {
     const struct bms_ic_bq769x2_config *config = dev->config;
     static uint8_t buf_data[0x20];
@@ -77,28 +261,13 @@ static int bq769x2_data_read(const struct device *dev, const uint16_t addr, uint
         goto err;
     }
 
-    /* wait until data is ready (commands need at least 50 us to complete) */
-    k_usleep(50);
-    int attempts = 1;
-    while (true) {
-        err = config->read_bytes(dev, BQ769X2_CMD_SUBCMD_LOWER, buf_data, 2);
-        if (err) {
-            goto err;
-        }
-        else if (buf_addr[0] == buf_data[0] && buf_addr[1] == buf_data[1]) {
-            /* processing inside chip finished */
-            break;
-        }
-        else if (attempts >= BQ769X2_READ_MAX_ATTEMPTS) {
-            LOG_ERR("Failed to read data at 0x%04X after %d attempts", addr,
-                    BQ769X2_READ_MAX_ATTEMPTS);
-            return -EIO;
-        }
-        else {
-            /* try again */
-            attempts++;
-            k_usleep(BQ769X2_READ_DELAY_US);
-        }
+    /* wait until data is ready */
+    err = bq769x2_subcmd_wait(dev, addr);
+    if (err == -EIO) {
+        return err;
+    }
+    else if (err) {
+        goto err;
     }
 
     /* read data length */
@@ -137,6 +306,10 @@ static int bq769x2_data_read(const struct device *dev, const uint16_t addr, uint
         return -EIO;
     }
 
+    if (num_read != NULL) {
+        *num_read = MIN(data_length, num_bytes);
+    }
+
     return 0;
 
 err:
@@ -144,14 +317,14 @@ err:
     return err;
 }
 
-static int bq769x2_data_write(const struct device *dev, const uint16_t addr, const uint32_t value,
-                              const size_t num_bytes)
+static int bq769x2_data_write_nolock(const struct device *dev, const uint16_t addr,
+                                     const uint8_t *data, const size_t num_bytes)
 {
     const struct bms_ic_bq769x2_config *config = dev->config;
-    uint8_t buf_data[4];
+    uint8_t buf[2];
     int err;
 
-    __ASSERT(num_bytes <= 4, "num_bytes 0x%X invalid", num_bytes);
+    __ASSERT(num_bytes <= BQ769X2_DATA_BUFFER_SIZE, "num_bytes 0x%X invalid", num_bytes);
 
     /* write the subcommand / data mem register address we want to write data to */
     uint8_t buf_addr[2] = { addr & 0x00FF, addr >> 8 };
@@ -164,29 +337,30 @@ static int bq769x2_data_write(const struct device *dev, const uint16_t addr, con
         /* write actual data and calculate checksum */
         uint8_t checksum = buf_addr[0] + buf_addr[1];
         for (int i = 0; i < num_bytes; i++) {
-            buf_data[i] = (value >> (i * 8)) & 0x000000FF;
-            checksum += buf_data[i];
+            checksum += data[i];
         }
         checksum = ~checksum;
-        err = config->write_bytes(dev, BQ769X2_SUBCMD_DATA_START, buf_data, num_bytes);
+        err = config->write_bytes(dev, BQ769X2_SUBCMD_DATA_START, data, num_bytes);
         if (err) {
             goto err;
         }
 
         /* write checksum and data length as one word */
-        buf_data[0] = checksum;
-        buf_data[1] = num_bytes + BQ769X2_SUBCMD_OVERHEAD_BYTES;
-        err = config->write_bytes(dev, BQ769X2_SUBCMD_DATA_CHECKSUM, buf_data, 2);
+        buf[0] = checksum;
+        buf[1] = num_bytes + BQ769X2_SUBCMD_OVERHEAD_BYTES;
+        err = config->write_bytes(dev, BQ769X2_SUBCMD_DATA_CHECKSUM, buf, 2);
         if (err) {
             goto err;
         }
     }
 
     /*
-     * Add a small delay to avoid failures of subsequent read operations. Suitable value was
-     * found through testing (datasheet does not mention any required delays after writing).
+     * The subcommand registers read back the written address immediately, so unlike for reads
+     * the echo can't be used to detect completion of a write. Add a small delay to avoid failures
+     * of subsequent read operations. Suitable value was found through testing (datasheet does
+     * not mention any required delays after writing).
      */
-    k_usleep(200);
+    k_usleep(BQ769X2_WRITE_DELAY_US);
 
     return 0;
 
@@ -195,11 +369,36 @@ err:
     return err;
 }
 
+/* subcommands consist of several transfers, which must not be interleaved with other threads */
+static int bq769x2_data_read(const struct device *dev, const uint16_t addr, uint8_t *bytes,
+                             const size_t num_bytes, size_t *num_read)
+{
+    struct bms_ic_bq769x2_data *data = dev->data;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+    int err = bq769x2_data_read_nolock(dev, addr, bytes, num_bytes, num_read);
+    k_mutex_unlock(&data->lock);
+
+    return err;
+}
+
+static int bq769x2_data_write(const struct device *dev, const uint16_t addr, const uint8_t *data,
+                              const size_t num_bytes)
+{
+    struct bms_ic_bq769x2_data *dev_data = dev->data;
+
+    k_mutex_lock(&dev_data->lock, K_FOREVER);
+    int err = bq769x2_data_write_nolock(dev, addr, data, num_bytes);
+    k_mutex_unlock(&dev_data->lock);
+
+    return err;
+}
+
 int bq769x2_subcmd_cmd_only(const struct device *dev, const uint16_t subcmd)
 {
     __ASSERT(!BQ769X2_IS_DATA_MEM_REG_ADDR(subcmd), "invalid subcmd: 0x%x", subcmd);
 
-    return bq769x2_data_write(dev, subcmd, 0, 0);
+    return bq769x2_data_write(dev, subcmd, NULL, 0);
 }
 
 int bq769x2_subcmd_read_u1(const struct device *dev, const uint16_t subcmd, uint8_t *value)
@@ -208,7 +407,7 @@ int bq769x2_subcmd_read_u1(const struct device *dev, const uint16_t subcmd, uint
 
     uint8_t buf[1];
 
-    int err = bq769x2_data_read(dev, subcmd, buf, sizeof(buf));
+    int err = bq769x2_data_read(dev, subcmd, buf, sizeof(buf), NULL);
     if (!err) {
         *value = buf[0];
     }
@@ -222,7 +421,7 @@ int bq769x2_subcmd_read_u2(const struct device *dev, const uint16_t subcmd, uint
 
     uint8_t buf[2];
 
-    int err = bq769x2_data_read(dev, subcmd, buf, sizeof(buf));
+    int err = bq769x2_data_read(dev, subcmd, buf, sizeof(buf), NULL);
     if (!err) {
         *value = buf[0] | buf[1] << 8;
     }
@@ -236,7 +435,7 @@ int bq769x2_subcmd_read_u4(const struct device *dev, const uint16_t subcmd, uint
 
     uint8_t buf[4];
 
-    int err = bq769x2_data_read(dev, subcmd, buf, sizeof(buf));
+    int err = bq769x2_data_read(dev, subcmd, buf, sizeof(buf), NULL);
     if (!err) {
         *value = buf[0] | buf[1] << 8 | buf[2] << 16 | buf[3] << 24;
     }
@@ -244,80 +443,481 @@ int bq769x2_subcmd_read_u4(const struct device *dev, const uint16_t subcmd, uint
     return err;
 }
 
+int bq769x2_subcmd_read_bytes(const struct device *dev, const uint16_t subcmd, uint8_t *buf,
+                              const size_t num_bytes)
+{
+    __ASSERT(!BQ769X2_IS_DATA_MEM_REG_ADDR(subcmd), "invalid subcmd: 0x%x", subcmd);
+
+    size_t num_read;
+
+    int err = bq769x2_data_read(dev, subcmd, buf, num_bytes, &num_read);
+    if (!err && num_read < num_bytes) {
+        LOG_ERR("Subcmd 0x%X returned only %u bytes", subcmd, (unsigned int)num_read);
+        return -EIO;
+    }
+
+    return err;
+}
+
 int bq769x2_subcmd_write_u1(const struct device *dev, const uint16_t subcmd, uint8_t value)
 {
     __ASSERT(!BQ769X2_IS_DATA_MEM_REG_ADDR(subcmd), "invalid subcmd: 0x%x", subcmd);
 
-    return bq769x2_data_write(dev, subcmd, value, 1);
+    return bq769x2_data_write(dev, subcmd, &value, 1);
 }
 
 int bq769x2_subcmd_write_u2(const struct device *dev, const uint16_t subcmd, uint16_t value)
 {
     __ASSERT(!BQ769X2_IS_DATA_MEM_REG_ADDR(subcmd), "invalid subcmd: 0x%x", subcmd);
 
-    return bq769x2_data_write(dev, subcmd, value, 2);
+    uint8_t buf[2];
+
+    sys_put_le16(value, buf);
+
+    return bq769x2_data_write(dev, subcmd, buf, sizeof(buf));
 }
 
 int bq769x2_subcmd_write_i2(const struct device *dev, const uint16_t subcmd, int16_t value)
 {
     __ASSERT(!BQ769X2_IS_DATA_MEM_REG_ADDR(subcmd), "invalid subcmd: 0x%x", subcmd);
 
-    return bq769x2_data_write(dev, subcmd, value, 2);
+    uint8_t buf[2];
+
+    sys_put_le16(value, buf);
+
+    return bq769x2_data_write(dev, subcmd, buf, sizeof(buf));
 }
 
-int bq769x2_config_update_mode(const struct device *dev, bool config_update)
+#ifdef CONFIG_BMS_IC_BQ769X2_DATAMEM_CACHE
+
+static inline bool bq769x2_datamem_cache_test(const uint32_t *bitmap, size_t pos)
+{
+    return bitmap[pos / 32] & BIT(pos % 32);
+}
+
+static bool bq769x2_datamem_cache_load(struct bms_ic_bq769x2_data *data, const uint16_t reg_addr,
+                                       uint8_t *bytes, const size_t num_bytes)
+{
+    size_t pos = reg_addr - BQ769X2_DATA_MEM_START;
+
+    for (size_t i = pos; i < pos + num_bytes; i++) {
+        if (!bq769x2_datamem_cache_test(data->datamem_cache_valid, i)) {
+            return false;
+        }
+    }
+
+    memcpy(bytes, &data->datamem_cache[pos], num_bytes);
+
+    return true;
+}
+
+static bool bq769x2_datamem_cache_equal(struct bms_ic_bq769x2_data *data, const uint16_t reg_addr,
+                                        const uint8_t *bytes, const size_t num_bytes)
+{
+    size_t pos = reg_addr - BQ769X2_DATA_MEM_START;
+
+    for (size_t i = pos; i < pos + num_bytes; i++) {
+        if (!bq769x2_datamem_cache_test(data->datamem_cache_valid, i)) {
+            return false;
+        }
+    }
+
+    return memcmp(&data->datamem_cache[pos], bytes, num_bytes) == 0;
+}
+
+static void bq769x2_datamem_cache_store(struct bms_ic_bq769x2_data *data, const uint16_t reg_addr,
+                                        const uint8_t *bytes, const size_t num_bytes)
+{
+    size_t pos = reg_addr - BQ769X2_DATA_MEM_START;
+
+    memcpy(&data->datamem_cache[pos], bytes, num_bytes);
+    for (size_t i = pos; i < pos + num_bytes; i++) {
+        data->datamem_cache_valid[i / 32] |= BIT(i % 32);
+        data->datamem_cache_dirty[i / 32] &= ~BIT(i % 32);
+    }
+}
+
+/* stores only bytes which are not known yet, so that pending writes are not overwritten */
+static void bq769x2_datamem_cache_fill(struct bms_ic_bq769x2_data *data, const uint16_t reg_addr,
+                                       const uint8_t *bytes, const size_t num_bytes)
+{
+    size_t pos = reg_addr - BQ769X2_DATA_MEM_START;
+
+    for (size_t i = 0; i < num_bytes; i++) {
+        if (!bq769x2_datamem_cache_test(data->datamem_cache_valid, pos + i)) {
+            data->datamem_cache[pos + i] = bytes[i];
+            data->datamem_cache_valid[(pos + i) / 32] |= BIT((pos + i) % 32);
+        }
+    }
+}
+
+static void bq769x2_datamem_cache_clear(struct bms_ic_bq769x2_data *data, const uint16_t reg_addr,
+                                        const size_t num_bytes)
+{
+    size_t pos = reg_addr - BQ769X2_DATA_MEM_START;
+
+    for (size_t i = pos; i < pos + num_bytes; i++) {
+        data->datamem_cache_valid[i / 32] &= ~BIT(i % 32);
+        data->datamem_cache_dirty[i / 32] &= ~BIT(i % 32);
+    }
+}
+
+static bool bq769x2_datamem_cache_stage(struct bms_ic_bq769x2_data *data, const uint16_t reg_addr,
+                                        const uint8_t *bytes, const size_t num_bytes)
+{
+    size_t pos = reg_addr - BQ769X2_DATA_MEM_START;
+
+    memcpy(&data->datamem_cache[pos], bytes, num_bytes);
+    for (size_t i = pos; i < pos + num_bytes; i++) {
+        data->datamem_cache_valid[i / 32] |= BIT(i % 32);
+        data->datamem_cache_dirty[i / 32] |= BIT(i % 32);
+    }
+
+    return true;
+}
+
+/* discards pending writes, as the device content of these registers is unknown afterwards */
+static void bq769x2_datamem_cache_discard(struct bms_ic_bq769x2_data *data)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(data->datamem_cache_dirty); i++) {
+        data->datamem_cache_valid[i] &= ~data->datamem_cache_dirty[i];
+        data->datamem_cache_dirty[i] = 0;
+    }
+}
+
+static bool bq769x2_datamem_cache_dirty_in_range(struct bms_ic_bq769x2_data *data, size_t from,
+                                                 size_t to)
+{
+    for (size_t i = from; i < to; i++) {
+        if (bq769x2_datamem_cache_test(data->datamem_cache_dirty, i)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * Writes all pending values to the device. Pending bytes are combined into blocks of up to
+ * 32 bytes. Unknown registers in between are read from the device first, as a single read
+ * returns up to 32 bytes and is still less expensive than an additional write.
+ */
+static int bq769x2_datamem_cache_flush(const struct device *dev)
 {
     struct bms_ic_bq769x2_data *data = dev->data;
-    int err;
+    uint8_t buf[BQ769X2_DATA_BUFFER_SIZE];
+    size_t num_read;
+    int err = 0;
+
+    for (size_t pos = 0; pos < BQ769X2_DATAMEM_CACHE_SIZE; pos++) {
+        if (!bq769x2_datamem_cache_test(data->datamem_cache_dirty, pos)) {
+            continue;
+        }
+
+        size_t block_start = pos;
+        size_t block_end = pos + 1;
+        size_t limit = MIN(pos + BQ769X2_DATA_BUFFER_SIZE, BQ769X2_DATAMEM_CACHE_SIZE);
+
+        for (size_t i = block_end; i < limit; i++) {
+            if (!bq769x2_datamem_cache_test(data->datamem_cache_valid, i)) {
+                if (!bq769x2_datamem_cache_dirty_in_range(data, i + 1, limit)) {
+                    break;
+                }
+
+                /* unknown register in between needed to extend the block to further writes */
+                uint16_t gap_addr = BQ769X2_DATA_MEM_START + i;
+                if (bq769x2_data_read(dev, gap_addr, buf, limit - i, &num_read) != 0) {
+                    break;
+                }
+                bq769x2_datamem_cache_fill(data, gap_addr, buf, num_read);
+                if (!bq769x2_datamem_cache_test(data->datamem_cache_valid, i)) {
+                    break;
+                }
+            }
+            if (bq769x2_datamem_cache_test(data->datamem_cache_dirty, i)) {
+                block_end = i + 1;
+            }
+        }
+
+        if (!data->config_update_mode_enabled) {
+            err = bq769x2_config_update_mode(dev, true);
+            if (err != 0) {
+                bq769x2_datamem_cache_discard(data);
+                return err;
+            }
+        }
+
+        uint16_t block_addr = BQ769X2_DATA_MEM_START + block_start;
+        size_t block_len = block_end - block_start;
+        int ret = bq769x2_data_write(dev, block_addr, &data->datamem_cache[block_start], block_len);
+        if (ret != 0) {
+            bq769x2_datamem_cache_clear(data, block_addr, block_len);
+            err = ret;
+        }
+        else {
+            for (size_t i = block_start; i < block_end; i++) {
+                data->datamem_cache_dirty[i / 32] &= ~BIT(i % 32);
+            }
+        }
 
-    if (config_update) {
-        err = bq769x2_subcmd_cmd_only(dev, BQ769X2_SUBCMD_SET_CFGUPDATE);
-        k_usleep(2000); /* Datasheet: Table 9-2 */
+        pos = block_end - 1;
     }
-    else {
-        err = bq769x2_subcmd_cmd_only(dev, BQ769X2_SUBCMD_EXIT_CFGUPDATE);
-        k_usleep(1000); /* Datasheet: Table 9-2 */
+
+    return err;
+}
+
+void bq769x2_datamem_cache_invalidate(const struct device *dev)
+{
+    struct bms_ic_bq769x2_data *data = dev->data;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+    memset(data->datamem_cache_valid, 0, sizeof(data->datamem_cache_valid));
+    memset(data->datamem_cache_dirty, 0, sizeof(data->datamem_cache_dirty));
+    k_mutex_unlock(&data->lock);
+}
+
+#else
+
+static inline bool bq769x2_datamem_cache_load(struct bms_ic_bq769x2_data *data,
+                                              const uint16_t reg_addr, uint8_t *bytes,
+                                              const size_t num_bytes)
+{
+    return false;
+}
+
+static inline bool bq769x2_datamem_cache_equal(struct bms_ic_bq769x2_data *data,
+                                               const uint16_t reg_addr, const uint8_t *bytes,
+                                               const size_t num_bytes)
+{
+    return false;
+}
+
+static inline void bq769x2_datamem_cache_store(struct bms_ic_bq769x2_data *data,
+                                               const uint16_t reg_addr, const uint8_t *bytes,
+                                               const size_t num_bytes)
+{}
+
+static inline void bq769x2_datamem_cache_fill(struct bms_ic_bq769x2_data *data,
+                                              const uint16_t reg_addr, const uint8_t *bytes,
+                                              const size_t num_bytes)
+{}
+
+static inline void bq769x2_datamem_cache_clear(struct bms_ic_bq769x2_data *data,
+                                               const uint16_t reg_addr, const size_t num_bytes)
+{}
+
+static inline bool bq769x2_datamem_cache_stage(struct bms_ic_bq769x2_data *data,
+                                               const uint16_t reg_addr, const uint8_t *bytes,
+                                               const size_t num_bytes)
+{
+    return false;
+}
+
+static inline int bq769x2_datamem_cache_flush(const struct device *dev)
+{
+    return 0;
+}
+
+void bq769x2_datamem_cache_invalidate(const struct device *dev)
+{}
+
+#endif /* CONFIG_BMS_IC_BQ769X2_DATAMEM_CACHE */
+
+static int bq769x2_config_update_mode_nolock(const struct device *dev, bool config_update)
+{
+    struct bms_ic_bq769x2_data *data = dev->data;
+    uint16_t subcmd = config_update ? BQ769X2_SUBCMD_SET_CFGUPDATE : BQ769X2_SUBCMD_EXIT_CFGUPDATE;
+
+    int err = bq769x2_subcmd_cmd_only(dev, subcmd);
+    if (err != 0) {
+        return err;
     }
 
+    /* mode change is polled after the expected execution time according to datasheet Table 9-2 */
+    err = bq769x2_wait_complete(dev, bq769x2_subcmd_time_us(subcmd), bq769x2_check_cfgupdate,
+                                config_update);
     if (err != 0) {
+        return -EIO;
+    }
+
+    data->config_update_mode_enabled = config_update;
+
+    return 0;
+}
+
+int bq769x2_config_update_mode(const struct device *dev, bool config_update)
+{
+    struct bms_ic_bq769x2_data *data = dev->data;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+    int err = bq769x2_config_update_mode_nolock(dev, config_update);
+    k_mutex_unlock(&data->lock);
+
+    return err;
+}
+
+int bq769x2_config_update_begin(const struct device *dev)
+{
+    struct bms_ic_bq769x2_data *data = dev->data;
+    union bq769x2_reg_bat_status bat_status;
+
+    /*
+     * Other threads must neither access the data memory nor the cache until the pending writes
+     * are flushed, so the lock is only released in bq769x2_config_update_end().
+     */
+    k_mutex_lock(&data->lock, K_FOREVER);
+
+    int err = bq769x2_direct_read_u2(dev, BQ769X2_CMD_BATTERY_STATUS, &bat_status.u16);
+    if (err != 0) {
+        k_mutex_unlock(&data->lock);
         return err;
     }
 
-    /* Check mode change and wait for up to 2 more ms for change to take effect. */
-    for (int attempt = 0; attempt < 5; attempt++) {
-        union bq769x2_reg_bat_status bat_status;
-        err = bq769x2_direct_read_u2(dev, BQ769X2_CMD_BATTERY_STATUS, &bat_status.u16);
-        if (err == 0 && !!bat_status.CFGUPDATE == config_update) {
-            data->config_update_mode_enabled = config_update;
-            return 0;
-        }
-        k_usleep(500);
+    if (bat_status.POR) {
+        /* device was reset since the last config update, so the RAM shadow is outdated */
+        bq769x2_datamem_cache_invalidate(dev);
     }
 
-    return -EIO;
+    data->config_update_deferred = true;
+
+    return 0;
 }
 
-int bq769x2_datamem_read_u1(const struct device *dev, const uint16_t reg_addr, uint8_t *value)
+int bq769x2_config_update_end(const struct device *dev)
+{
+    struct bms_ic_bq769x2_data *data = dev->data;
+    int err = 0;
+
+    err |= bq769x2_datamem_cache_flush(dev);
+
+    data->config_update_deferred = false;
+
+    if (data->config_update_mode_enabled) {
+        err |= bq769x2_config_update_mode_nolock(dev, false);
+    }
+
+    k_mutex_unlock(&data->lock);
+
+    return err == 0 ? 0 : -EIO;
+}
+
+static int bq769x2_datamem_read_nolock(const struct device *dev, const uint16_t reg_addr,
+                                       uint8_t *bytes, const size_t num_bytes)
 {
+    struct bms_ic_bq769x2_data *data = dev->data;
+    uint8_t buf[BQ769X2_DATA_BUFFER_SIZE];
+    size_t num_read;
+
     __ASSERT(BQ769X2_IS_DATA_MEM_REG_ADDR(reg_addr), "invalid data memory register");
 
-    uint8_t buf[1];
+    if (bq769x2_datamem_cache_load(data, reg_addr, bytes, num_bytes)) {
+        data->skipped_transfers++;
+        return 0;
+    }
 
-    int err = bq769x2_data_read(dev, reg_addr, buf, sizeof(buf));
-    if (!err) {
-        *value = buf[0];
+    /* device returns up to 32 bytes for data memory reads, which are all stored in the cache */
+    size_t max_bytes = MIN(sizeof(buf), BQ769X2_DATA_MEM_END - reg_addr);
+    int err = bq769x2_data_read(dev, reg_addr, buf, max_bytes, &num_read);
+    if (err) {
+        return err;
+    }
+    else if (num_read < num_bytes) {
+        LOG_ERR("Data memory read at 0x%04X returned only %zu bytes", reg_addr, num_read);
+        return -EIO;
     }
 
+    bq769x2_datamem_cache_fill(data, reg_addr, buf, num_read);
+
+    /* cache may contain pending writes that have not been sent to the device yet */
+    if (!bq769x2_datamem_cache_load(data, reg_addr, bytes, num_bytes)) {
+        memcpy(bytes, buf, num_bytes);
+    }
+
+    return 0;
+}
+
+/* cache lookup and fill must not be interleaved with the accesses of other threads */
+static int bq769x2_datamem_read(const struct device *dev, const uint16_t reg_addr, uint8_t *bytes,
+                                const size_t num_bytes)
+{
+    struct bms_ic_bq769x2_data *data = dev->data;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+    int err = bq769x2_datamem_read_nolock(dev, reg_addr, bytes, num_bytes);
+    k_mutex_unlock(&data->lock);
+
     return err;
 }
 
-int bq769x2_datamem_read_u2(const struct device *dev, const uint16_t reg_addr, uint16_t *value)
+static int bq769x2_datamem_write_block_nolock(const struct device *dev, const uint16_t reg_addr,
+                                              const uint8_t *bytes, const size_t num_bytes)
 {
+    struct bms_ic_bq769x2_data *data = dev->data;
+    int err;
+
+    __ASSERT(data->config_update_mode_enabled || data->config_update_deferred,
+             "bq769x2 config update mode not enabled");
     __ASSERT(BQ769X2_IS_DATA_MEM_REG_ADDR(reg_addr), "invalid data memory register");
 
+    if (num_bytes > BQ769X2_DATA_BUFFER_SIZE || num_bytes < 1
+        || reg_addr + num_bytes > BQ769X2_DATA_MEM_END)
+    {
+        return -EINVAL;
+    }
+
+    if (bq769x2_datamem_cache_equal(data, reg_addr, bytes, num_bytes)) {
+        data->skipped_transfers++;
+        return 0;
+    }
+
+    if (data->config_update_deferred
+        && bq769x2_datamem_cache_stage(data, reg_addr, bytes, num_bytes))
+    {
+        /* sent together with adjacent registers in bq769x2_config_update_end() */
+        return 0;
+    }
+
+    if (!data->config_update_mode_enabled) {
+        err = bq769x2_config_update_mode_nolock(dev, true);
+        if (err != 0) {
+            return err;
+        }
+    }
+
+    err = bq769x2_data_write_nolock(dev, reg_addr, bytes, num_bytes);
+    if (err) {
+        /* register content is unknown after a failed write */
+        bq769x2_datamem_cache_clear(data, reg_addr, num_bytes);
+    }
+    else {
+        bq769x2_datamem_cache_store(data, reg_addr, bytes, num_bytes);
+    }
+
+    return err;
+}
+
+int bq769x2_datamem_write_block(const struct device *dev, const uint16_t reg_addr,
+                                const uint8_t *bytes, const size_t num_bytes)
+{
+    struct bms_ic_bq769x2_data *data = dev->data;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+    int err = bq769x2_datamem_write_block_nolock(dev, reg_addr, bytes, num_bytes);
+    k_mutex_unlock(&data->lock);
+
+    return err;
+}
+
+int bq769x2_datamem_read_u1(const struct device *dev, const uint16_t reg_addr, uint8_t *value)
+{
+    return bq769x2_datamem_read(dev, reg_addr, value, 1);
+}
+
+int bq769x2_datamem_read_u2(const struct device *dev, const uint16_t reg_addr, uint16_t *value)
+{
     uint8_t buf[2];
 
-    int err = bq769x2_data_read(dev, reg_addr, buf, sizeof(buf));
+    int err = bq769x2_datamem_read(dev, reg_addr, buf, sizeof(buf));
     if (!err) {
         *value = buf[0] | buf[1] << 8;
     }
@@ -327,11 +927,9 @@ int bq769x2_datamem_read_u2(const struct device *dev, const uint16_t reg_addr, u
 
 int bq769x2_datamem_read_f4(const struct device *dev, const uint16_t reg_addr, float *value)
 {
-    __ASSERT(BQ769X2_IS_DATA_MEM_REG_ADDR(reg_addr), "invalid data memory register");
-
     uint8_t buf[4];
 
-    int err = bq769x2_data_read(dev, reg_addr, buf, sizeof(buf));
+    int err = bq769x2_datamem_read(dev, reg_addr, buf, sizeof(buf));
     if (!err) {
         *(uint32_t *)value = buf[0] | buf[1] << 8 | buf[2] << 16 | buf[3] << 24;
     }
@@ -341,52 +939,37 @@ int bq769x2_datamem_read_f4(const struct device *dev, const uint16_t reg_addr, f
 
 int bq769x2_datamem_write_u1(const struct device *dev, const uint16_t reg_addr, uint8_t value)
 {
-    __maybe_unused const struct bms_ic_bq769x2_data *data = dev->data;
-
-    __ASSERT(data->config_update_mode_enabled, "bq769x2 config update mode not enabled");
-    __ASSERT(BQ769X2_IS_DATA_MEM_REG_ADDR(reg_addr), "invalid data memory register");
-
-    return bq769x2_data_write(dev, reg_addr, value, 1);
+    return bq769x2_datamem_write_block(dev, reg_addr, &value, 1);
 }
 
 int bq769x2_datamem_write_u2(const struct device *dev, const uint16_t reg_addr, uint16_t value)
 {
-    __maybe_unused const struct bms_ic_bq769x2_data *data = dev->data;
+    uint8_t buf[2];
 
-    __ASSERT(data->config_update_mode_enabled, "bq769x2 config update mode not enabled");
-    __ASSERT(BQ769X2_IS_DATA_MEM_REG_ADDR(reg_addr), "invalid data memory register");
+    sys_put_le16(value, buf);
 
-    return bq769x2_data_write(dev, reg_addr, value, 2);
+    return bq769x2_datamem_write_block(dev, reg_addr, buf, sizeof(buf));
 }
 
 int bq769x2_datamem_write_i1(const struct device *dev, const uint16_t reg_addr, int8_t value)
 {
-    __maybe_unused const struct bms_ic_bq769x2_data *data = dev->data;
-
-    __ASSERT(data->config_update_mode_enabled, "bq769x2 config update mode not enabled");
-    __ASSERT(BQ769X2_IS_DATA_MEM_REG_ADDR(reg_addr), "invalid data memory register");
-
-    return bq769x2_data_write(dev, reg_addr, value, 1);
+    return bq769x2_datamem_write_block(dev, reg_addr, (uint8_t *)&value, 1);
 }
 
 int bq769x2_datamem_write_i2(const struct device *dev, const uint16_t reg_addr, int16_t value)
 {
-    __maybe_unused const struct bms_ic_bq769x2_data *data = dev->data;
+    uint8_t buf[2];
 
-    __ASSERT(data->config_update_mode_enabled, "bq769x2 config update mode not enabled");
-    __ASSERT(BQ769X2_IS_DATA_MEM_REG_ADDR(reg_addr), "invalid data memory register");
+    sys_put_le16(value, buf);
 
-    return bq769x2_data_write(dev, reg_addr, value, 2);
+    return bq769x2_datamem_write_block(dev, reg_addr, buf, sizeof(buf));
 }
 
 int bq769x2_datamem_write_f4(const struct device *dev, const uint16_t reg_addr, float value)
 {
-    __maybe_unused const struct bms_ic_bq769x2_data *data = dev->data;
-
-    __ASSERT(data->config_update_mode_enabled, "bq769x2 config update mode not enabled");
-    __ASSERT(BQ769X2_IS_DATA_MEM_REG_ADDR(reg_addr), "invalid data memory register");
+    uint8_t buf[4];
 
-    uint32_t *u32 = (uint32_t *)&value;
+    sys_put_le32(*(uint32_t *)&value, buf);
 
-    return bq769x2_data_write(dev, reg_addr, *u32, 4);
+    return bq769x2_datamem_write_block(dev, reg_addr, buf, sizeof(buf));
 }
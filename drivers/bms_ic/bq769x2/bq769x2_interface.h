@@ -17,6 +17,23 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+/**
+ * Statistics of the time spent waiting for completion of subcommands and mode changes
+ */
+struct bq769x2_wait_stats
+{
+    /** Number of completed operations */
+    uint32_t count;
+    /** Number of operations not completed within the timeout */
+    uint32_t timeouts;
+    /** Number of status reads for completion polling */
+    uint32_t polls;
+    /** Total time spent waiting for completed operations (us) */
+    uint32_t total_us;
+    /** Max. time spent waiting for a single operation (us) */
+    uint32_t max_us;
+};
+
 /**
  * Set bq769x2 config update mode
  *
@@ -27,6 +44,59 @@
  */
 int bq769x2_config_update_mode(const struct device *dev, bool config_update);
 
+/**
+ * Prepare a sequence of bq769x2 data memory writes
+ *
+ * Config update mode is not entered immediately, but only before the first data memory write
+ * which actually changes a value. If the device was reset since the last config update, the RAM
+ * shadow of the data memory is invalidated.
+ *
+ * If successful, the device is locked for other threads until bq769x2_config_update_end(), which
+ * must always be called afterwards. In case of an error, the device is not locked and neither
+ * data memory writes nor bq769x2_config_update_end() must follow.
+ *
+ * @param dev Pointer to the driver device structure instance
+ *
+ * @returns 0 if successful, negative errno otherwise
+ */
+int bq769x2_config_update_begin(const struct device *dev);
+
+/**
+ * Finish a sequence of bq769x2 data memory writes
+ *
+ * Config update mode is exited if it was entered since bq769x2_config_update_begin().
+ *
+ * @param dev Pointer to the driver device structure instance
+ *
+ * @returns 0 if successful, negative errno otherwise
+ */
+int bq769x2_config_update_end(const struct device *dev);
+
+/**
+ * Invalidate the RAM shadow of the bq769x2 data memory
+ *
+ * Must be called if the data memory may have been changed without the bq769x2_datamem_write
+ * functions, e.g. after a reset of the device.
+ *
+ * @param dev Pointer to the driver device structure instance
+ */
+void bq769x2_datamem_cache_invalidate(const struct device *dev);
+
+/**
+ * Get statistics of the time spent waiting for completion of subcommands
+ *
+ * @param dev Pointer to the driver device structure instance
+ * @param stats Pointer to where the statistics should be stored
+ */
+void bq769x2_wait_stats_get(const struct device *dev, struct bq769x2_wait_stats *stats);
+
+/**
+ * Reset statistics of the time spent waiting for completion of subcommands
+ *
+ * @param dev Pointer to the driver device structure instance
+ */
+void bq769x2_wait_stats_reset(const struct device *dev);
+
 /**
  * Read 8-bit unsigned integer via direct command from bq769x2 IC
  *
@@ -60,6 +130,30 @@ int bq769x2_direct_read_u2(const struct device *dev, const uint8_t reg_addr, uin
  */
 int bq769x2_direct_read_i2(const struct device *dev, const uint8_t reg_addr, int16_t *value);
 
+/**
+ * Read a block of consecutive direct command registers from bq769x2 IC in a single transfer
+ *
+ * @param dev Pointer to the driver device structure instance
+ * @param reg_addr The address of the first register to read
+ * @param data Pointer to the buffer where the data should be stored
+ * @param num_bytes Number of bytes to read (max. 32)
+ *
+ * @returns 0 if successful, negative errno otherwise
+ */
+int bq769x2_direct_read_block(const struct device *dev, const uint8_t reg_addr, uint8_t *data,
+                              const size_t num_bytes);
+
+/**
+ * Write 16-bit unsigned integer via direct command to bq769x2 IC
+ *
+ * @param dev Pointer to the driver device structure instance
+ * @param reg_addr The address of the register to write to
+ * @param value The value to be written
+ *
+ * @returns 0 if successful, negative errno otherwise
+ */
+int bq769x2_direct_write_u2(const struct device *dev, const uint8_t reg_addr, const uint16_t value);
+
 /**
  * Execute subcommand without data (command-only) in bq769x2 IC
  *
@@ -103,6 +197,21 @@ int bq769x2_subcmd_read_u2(const struct device *dev, const uint16_t subcmd, uint
  */
 int bq769x2_subcmd_read_u4(const struct device *dev, const uint16_t subcmd, uint32_t *value);
 
+/**
+ * Read a block of bytes via subcommand from bq769x2 IC
+ *
+ * Used for subcommands returning multiple values at once, e.g. DASTATUS1 to DASTATUS7.
+ *
+ * @param dev Pointer to the driver device structure instance
+ * @param subcmd The subcommand to read the bytes from
+ * @param buf Buffer to store the data
+ * @param num_bytes Number of bytes to read (max. 32)
+ *
+ * @returns 0 if successful, negative errno otherwise (also if the IC returned less bytes)
+ */
+int bq769x2_subcmd_read_bytes(const struct device *dev, const uint16_t subcmd, uint8_t *buf,
+                              const size_t num_bytes);
+
 /**
  * Read 16-bit signed integer via subcommand from bq769x2 IC
  *
@@ -166,6 +275,23 @@ int bq769x2_subcmd_write_u2(const struct device *dev, const uint16_t subcmd, uin
  */
 int bq769x2_subcmd_write_i2(const struct device *dev, const uint16_t subcmd, int16_t value);
 
+/**
+ * Write a block of contiguous registers to bq769x2 data memory in a single transfer
+ *
+ * If called between bq769x2_config_update_begin() and bq769x2_config_update_end(), the data is
+ * only stored in the RAM shadow and combined with writes to adjacent registers when config update
+ * mode is finished (requires CONFIG_BMS_IC_BQ769X2_DATAMEM_CACHE).
+ *
+ * @param dev Pointer to the driver device structure instance
+ * @param reg_addr The address of the first data memory register to write
+ * @param bytes Pointer to the data in little-endian byte order
+ * @param num_bytes Number of bytes to write (max. 32)
+ *
+ * @returns 0 if successful, negative errno otherwise
+ */
+int bq769x2_datamem_write_block(const struct device *dev, const uint16_t reg_addr,
+                                const uint8_t *bytes, const size_t num_bytes);
+
 /**
  * Read 8-bit unsigned integer from bq769x2 data memory
  *
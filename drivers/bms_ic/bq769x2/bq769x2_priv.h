@@ -12,6 +12,16 @@
  * @brief Private functions and definitions for bq769x2 IC driver
  */
 
+#include "bq769x2_interface.h"
+#include "bq769x2_registers.h"
+
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+#include "bms_ic_snapshot.h"
+#endif
+#ifdef CONFIG_BMS_IC_ASYNC
+#include "bms_ic_async.h"
+#endif
+
 #include <drivers/bms_ic.h>
 
 #include <stdint.h>
@@ -20,6 +30,8 @@
 #include <zephyr/device.h>
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/spi.h>
+#include <zephyr/kernel.h>
 
 /**
  * Writes multiple bytes to bq769x2 IC registers
@@ -45,10 +57,36 @@ typedef int (*bq769x2_write_bytes_t)(const struct device *dev, const uint8_t reg
 typedef int (*bq769x2_read_bytes_t)(const struct device *dev, const uint8_t reg_addr, uint8_t *data,
                                     const size_t num_bytes);
 
+/**
+ * Checks if the bus used to communicate with the bq769x2 IC is ready
+ *
+ * @returns true if the bus is ready for use
+ */
+typedef bool (*bq769x2_bus_ready_t)(const struct device *dev);
+
+/**
+ * Tries to recover the bus used to communicate with the bq769x2 IC after errors
+ *
+ * @returns 0 if successful, negative errno otherwise
+ */
+typedef int (*bq769x2_bus_recover_t)(const struct device *dev);
+
+/* bus specification, depending on the devicetree compatible of the device */
+union bq769x2_bus
+{
+    struct i2c_dt_spec i2c;
+    struct spi_dt_spec spi;
+};
+
+#ifdef CONFIG_BMS_IC_BQ769X2_DATAMEM_CACHE
+/* the entire data memory is mirrored in RAM */
+#define BQ769X2_DATAMEM_CACHE_SIZE (BQ769X2_DATA_MEM_END - BQ769X2_DATA_MEM_START)
+#endif
+
 /* read-only driver configuration */
 struct bms_ic_bq769x2_config
 {
-    struct i2c_dt_spec i2c;
+    union bq769x2_bus bus;
     struct gpio_dt_spec alert_gpio;
     uint32_t shunt_resistor_uohm;
     uint32_t board_max_current;
@@ -62,16 +100,53 @@ struct bms_ic_bq769x2_config
     uint8_t reg0_config;
     uint8_t reg12_config;
     uint8_t max_balanced_cells;
+    uint8_t cc3_samples;
     bq769x2_write_bytes_t write_bytes;
     bq769x2_read_bytes_t read_bytes;
+    bq769x2_bus_ready_t bus_ready;
+    bq769x2_bus_recover_t bus_recover;
 };
 
 /* driver run-time data */
 struct bms_ic_bq769x2_data
 {
+    const struct device *dev;
     struct bms_ic_data *ic_data;
+    /* serializes multi-transfer sequences (subcommands, SPI frames) of different threads */
+    struct k_mutex lock;
+    struct gpio_callback alert_cb;
+    struct k_work_delayable alert_work;
+    bms_ic_data_callback_t data_callback;
+    /* ALERT pin interrupt available, otherwise the application has to poll the data */
+    bool alert_enabled;
+    /* activation runs asynchronously in a work item, retrying until the IC responds */
+    struct k_work_delayable activation_work;
+    uint32_t activation_retry_ms;
+    uint16_t activation_attempts;
+    int activation_error;
+    bool activating;
+    /* last successfully requested power mode (SLEEP for IDLE, DEEPSLEEP for STANDBY) */
+    enum bms_ic_mode mode;
     bool config_update_mode_enabled;
+    bool config_update_deferred;
     bool auto_balancing;
+    uint32_t bus_round_trip_us;
+    struct bq769x2_wait_stats wait_stats;
+    /* data memory accesses served from the RAM shadow without a bus transfer */
+    uint32_t skipped_transfers;
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+    /* copies of ic_data published after each read, also if triggered by the alert work item */
+    struct bms_ic_snapshot_buf snapshot;
+#endif
+#ifdef CONFIG_BMS_IC_ASYNC
+    /* request of bms_ic_read_data_async(), handled in the system work queue */
+    struct bms_ic_async_read async_read;
+#endif
+#ifdef CONFIG_BMS_IC_BQ769X2_DATAMEM_CACHE
+    uint8_t datamem_cache[BQ769X2_DATAMEM_CACHE_SIZE];
+    uint32_t datamem_cache_valid[DIV_ROUND_UP(BQ769X2_DATAMEM_CACHE_SIZE, 32)];
+    uint32_t datamem_cache_dirty[DIV_ROUND_UP(BQ769X2_DATAMEM_CACHE_SIZE, 32)];
+#endif
 };
 
 #endif /* DRIVERS_BMS_IC_BMS_IC_BQ769X2_PRIV_H_ */
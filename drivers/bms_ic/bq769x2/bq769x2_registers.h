@@ -160,7 +160,11 @@
 
 /* Data Memory */
 
-#define BQ769X2_IS_DATA_MEM_REG_ADDR(addr) (addr >= 0x9180 && addr < 0x9400)
+#define BQ769X2_DATA_MEM_START (0x9180)
+#define BQ769X2_DATA_MEM_END   (0x9400)
+
+#define BQ769X2_IS_DATA_MEM_REG_ADDR(addr) \
+    (addr >= BQ769X2_DATA_MEM_START && addr < BQ769X2_DATA_MEM_END)
 
 /* Calibration (manual section 13.2) */
 
@@ -423,6 +427,10 @@ static const uint16_t bq769x2_scd_thresholds[] = {
     10, 20, 40, 60, 80, 100, 125, 150, 175, 200, 250, 300, 350, 400, 450, 500,
 }; /* mV */
 
+/* PIN_FXN field (bits 1:0) of the multi-function pin configs */
+#define BQ769X2_PIN_FXN_MASK  0x03
+#define BQ769X2_PIN_FXN_ALERT 0x02
+
 /* Status register content */
 
 union bq769x2_reg_safety_a {
@@ -522,6 +530,30 @@ union bq769x2_reg_bat_status {
     uint16_t u16;
 };
 
+/* same layout for ALARM_STATUS, ALARM_RAW_STATUS, ALARM_ENABLE and Default Alarm Mask */
+union bq769x2_reg_alarm {
+    struct
+    {
+        uint16_t WAKE : 1;
+        uint16_t ADSCAN : 1;
+        uint16_t CB : 1;
+        uint16_t FUSE : 1;
+        uint16_t SHUTV : 1;
+        uint16_t XDSG : 1;
+        uint16_t XCHG : 1;
+        uint16_t FULLSCAN : 1;
+        uint16_t RSVD_0 : 1;
+        uint16_t INITCOMP : 1;
+        uint16_t INITSTART : 1;
+        uint16_t MSK_PFALERT : 1;
+        uint16_t MSK_SFALERT : 1;
+        uint16_t PF : 1;
+        uint16_t SSA : 1;
+        uint16_t SSBC : 1;
+    };
+    uint16_t u16;
+};
+
 #define bq769x2_reg_alarm_sf_alert_mask_a bq769x2_reg_safety_a
 
 #define bq769x2_reg_alarm_sf_alert_mask_b bq769x2_reg_safety_b
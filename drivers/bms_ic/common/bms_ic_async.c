@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "bms_ic_async.h"
+
+#include <errno.h>
+
+static void bms_ic_async_read_handler(struct k_work *work)
+{
+    struct bms_ic_async_read *req = CONTAINER_OF(work, struct bms_ic_async_read, work);
+    struct k_poll_signal *signal = req->signal;
+
+    int err = bms_ic_read_data(req->dev, req->flags);
+
+    /* release the request before raising the signal, so that the next one can be submitted */
+    atomic_clear(&req->busy);
+
+    k_poll_signal_raise(signal, err);
+}
+
+void bms_ic_async_read_init(struct bms_ic_async_read *req, const struct device *dev)
+{
+    req->dev = dev;
+    atomic_clear(&req->busy);
+    k_work_init(&req->work, bms_ic_async_read_handler);
+}
+
+int bms_ic_async_read_submit(struct bms_ic_async_read *req, uint32_t flags,
+                             struct k_poll_signal *signal)
+{
+    if (!atomic_cas(&req->busy, 0, 1)) {
+        return -EBUSY;
+    }
+
+    req->flags = flags;
+    req->signal = signal;
+
+    k_work_submit(&req->work);
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef DRIVERS_BMS_IC_COMMON_BMS_IC_ASYNC_H_
+#define DRIVERS_BMS_IC_COMMON_BMS_IC_ASYNC_H_
+
+/**
+ * @file
+ * @brief Asynchronous reading of BMS IC data in a work item
+ */
+
+#include <drivers/bms_ic.h>
+
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Pending asynchronous read request of a driver instance
+ *
+ * The synchronous read function of the driver is called from the system work queue, so the bus
+ * transfers of the driver don't need to be changed. As the application may access the same device
+ * from its own thread in the meantime, drivers using this helper must serialize their API
+ * functions with a device lock.
+ */
+struct bms_ic_async_read
+{
+    struct k_work work;
+    const struct device *dev;
+    /** BMS_IC_DATA_* flags requested by the caller */
+    uint32_t flags;
+    /** Signal to be raised with the result of the read */
+    struct k_poll_signal *signal;
+    /** Set while a request is pending, so that it is not overwritten by a new one */
+    atomic_t busy;
+};
+
+/**
+ * Initialize the request object (typically during driver initialization)
+ *
+ * @param req Pointer to the request object
+ * @param dev Pointer to the device structure for the driver instance
+ */
+void bms_ic_async_read_init(struct bms_ic_async_read *req, const struct device *dev);
+
+/**
+ * Submit a new request
+ *
+ * @param req Pointer to the request object
+ * @param flags BMS_IC_DATA_* flags passed to bms_ic_read_data()
+ * @param signal Signal raised with the return value of bms_ic_read_data() after completion
+ *
+ * @retval 0 if the request was submitted
+ * @retval -EBUSY if the previous request is not finished yet
+ */
+int bms_ic_async_read_submit(struct bms_ic_async_read *req, uint32_t flags,
+                             struct k_poll_signal *signal);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVERS_BMS_IC_COMMON_BMS_IC_ASYNC_H_ */
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "bms_ic_balancing.h"
+
+#include <zephyr/sys/util.h>
+
+uint32_t bms_ic_balancing_plan(const float *cell_voltages, size_t num_cells, float threshold)
+{
+    /* best[i] is the maximum total excess voltage achievable with the first i cells */
+    float best[BMS_IC_BALANCING_MAX_CELLS + 1];
+    uint32_t cells = 0;
+
+    num_cells = MIN(num_cells, BMS_IC_BALANCING_MAX_CELLS);
+
+    best[0] = 0.0F;
+    for (size_t i = 0; i < num_cells; i++) {
+        float excess = cell_voltages[i] - threshold;
+        float with_cell = (i > 0 ? best[i - 1] : 0.0F) + excess;
+
+        /* a cell is either skipped or balanced together with the best selection up to i - 2 */
+        best[i + 1] = (excess > 0.0F && with_cell > best[i]) ? with_cell : best[i];
+    }
+
+    /* walk backwards through the table to find the cells which were selected */
+    for (size_t i = num_cells; i > 0;) {
+        if (best[i] != best[i - 1]) {
+            cells |= BIT(i - 1);
+            i = (i > 1) ? i - 2 : 0;
+        }
+        else {
+            i--;
+        }
+    }
+
+    return cells;
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef DRIVERS_BMS_IC_COMMON_BMS_IC_BALANCING_H_
+#define DRIVERS_BMS_IC_COMMON_BMS_IC_BALANCING_H_
+
+/**
+ * @file
+ * @brief Cell balancing planner shared by BMS IC drivers
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum number of cells supported by the planner (one bit per cell in the result) */
+#define BMS_IC_BALANCING_MAX_CELLS (32)
+
+/**
+ * Select the cells to be balanced without balancing adjacent cells at the same time
+ *
+ * All cells above the threshold voltage are candidates. Out of those, the subset of non-adjacent
+ * cells with the maximum sum of voltages above the threshold is selected using dynamic
+ * programming with O(n) complexity.
+ *
+ * @param cell_voltages Array of cell voltages (V)
+ * @param num_cells Number of cells in the array (max. BMS_IC_BALANCING_MAX_CELLS)
+ * @param threshold Voltage above which a cell should be balanced (V)
+ *
+ * @returns bitset of the cells to be balanced (bit 0 for the first cell in the array)
+ */
+uint32_t bms_ic_balancing_plan(const float *cell_voltages, size_t num_cells, float threshold);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVERS_BMS_IC_COMMON_BMS_IC_BALANCING_H_ */
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "bms_ic_charge.h"
+
+void bms_ic_charge_counter_update(struct bms_ic_charge_counter *cc, struct bms_ic_data *ic_data,
+                                  int64_t now)
+{
+    if (!cc->started) {
+        cc->start = now;
+        cc->started = true;
+    }
+    else {
+        /* mean current (A) * elapsed time (ms) * 1000 = uAs */
+        float mean_current = (cc->last_current + ic_data->current) * 0.5F;
+        cc->charge_uas += (int64_t)(mean_current * (float)(now - cc->last_update) * 1000.0F);
+    }
+
+    cc->last_update = now;
+    cc->last_current = ic_data->current;
+
+    ic_data->charge = cc->charge_uas * 1e-6F;
+    ic_data->charge_time = (uint32_t)((now - cc->start) / 1000);
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef DRIVERS_BMS_IC_COMMON_BMS_IC_CHARGE_H_
+#define DRIVERS_BMS_IC_COMMON_BMS_IC_CHARGE_H_
+
+/**
+ * @file
+ * @brief Software charge counter for BMS ICs without on-chip charge accumulator
+ */
+
+#include <drivers/bms_ic.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * State of the software charge counter
+ */
+struct bms_ic_charge_counter
+{
+    /** Accumulated charge (uAs), kept as integer to avoid loss of resolution */
+    int64_t charge_uas;
+    /** Uptime of first current measurement (ms) */
+    int64_t start;
+    /** Uptime of last current measurement (ms) */
+    int64_t last_update;
+    /** Last measured current (A) */
+    float last_current;
+    /** Set after the first current measurement */
+    bool started;
+};
+
+/**
+ * Integrate a new current measurement into the charge counter
+ *
+ * The trapezoidal rule is used, so the accuracy depends on how often this function is called
+ * (ideally for every new current measurement of the IC). The first call only starts the
+ * accumulation.
+ *
+ * @param cc Pointer to the charge counter state
+ * @param ic_data Pointer to the IC data containing the new current measurement. The charge and
+ *                charge_time members are updated by this function.
+ * @param now Uptime when the current was measured (ms)
+ */
+void bms_ic_charge_counter_update(struct bms_ic_charge_counter *cc, struct bms_ic_data *ic_data,
+                                  int64_t now);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVERS_BMS_IC_COMMON_BMS_IC_CHARGE_H_ */
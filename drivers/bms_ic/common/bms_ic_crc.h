@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef DRIVERS_BMS_IC_COMMON_BMS_IC_CRC_H_
+#define DRIVERS_BMS_IC_COMMON_BMS_IC_CRC_H_
+
+/**
+ * @file
+ * @brief CRC calculation shared by BMS IC drivers
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Calculate CRC-8 with polynomial x^8 + x^2 + x + 1 (0x07), as used for the I2C framing of
+ * Texas Instruments bq769x0 and bq769x2 ICs
+ *
+ * The result is identical to Zephyr's crc8_ccitt(), but a lookup table is used for faster
+ * calculation. The table size can be selected via Kconfig.
+ *
+ * @param crc Initial value (0 for a new calculation or the result of a previous calculation)
+ * @param buf Pointer to the data
+ * @param len Number of bytes
+ *
+ * @returns calculated CRC
+ */
+uint8_t bms_ic_crc8(uint8_t crc, const void *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVERS_BMS_IC_COMMON_BMS_IC_CRC_H_ */
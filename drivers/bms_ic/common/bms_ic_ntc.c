@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "bms_ic_ntc.h"
+
+#include <math.h>
+
+void bms_ic_ntc_table_init(struct bms_ic_ntc_table *table, uint16_t beta, float adc_full_scale)
+{
+    for (int i = 0; i < BMS_IC_NTC_TABLE_SIZE; i++) {
+        float temp_k = BMS_IC_NTC_TEMP_MIN + i * BMS_IC_NTC_TEMP_STEP + 273.15F;
+
+        /* thermistor resistance relative to pull-up resistor according to Beta equation */
+        float r_ratio = expf(beta * (1.0F / temp_k - 1.0F / (273.15F + 25)));
+
+        table->adc[i] = lroundf(adc_full_scale * r_ratio / (1.0F + r_ratio));
+    }
+}
+
+int16_t bms_ic_ntc_temp(const struct bms_ic_ntc_table *table, uint16_t adc)
+{
+    int low = 0;
+    int high = BMS_IC_NTC_TABLE_SIZE - 1;
+
+    if (adc >= table->adc[low]) {
+        return BMS_IC_NTC_TEMP_MIN * 10;
+    }
+    else if (adc <= table->adc[high]) {
+        return BMS_IC_NTC_TEMP_MAX * 10;
+    }
+
+    /* binary search for the interval with adc[low] > adc >= adc[high] */
+    while (high - low > 1) {
+        int mid = (low + high) / 2;
+        if (adc < table->adc[mid]) {
+            low = mid;
+        }
+        else {
+            high = mid;
+        }
+    }
+
+    int32_t delta = table->adc[low] - adc;
+    int32_t span = table->adc[low] - table->adc[high];
+
+    return (BMS_IC_NTC_TEMP_MIN + low * BMS_IC_NTC_TEMP_STEP) * 10
+           + (delta * BMS_IC_NTC_TEMP_STEP * 10 + span / 2) / span;
+}
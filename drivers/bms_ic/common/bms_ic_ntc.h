@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef DRIVERS_BMS_IC_COMMON_BMS_IC_NTC_H_
+#define DRIVERS_BMS_IC_COMMON_BMS_IC_NTC_H_
+
+/**
+ * @file
+ * @brief Lookup table based NTC thermistor conversion shared by BMS IC drivers
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Lowest temperature covered by the lookup table (°C) */
+#define BMS_IC_NTC_TEMP_MIN (-40)
+/** Highest temperature covered by the lookup table (°C) */
+#define BMS_IC_NTC_TEMP_MAX (120)
+/** Temperature difference between two lookup table points (°C) */
+#define BMS_IC_NTC_TEMP_STEP (5)
+
+#define BMS_IC_NTC_TABLE_SIZE \
+    ((BMS_IC_NTC_TEMP_MAX - BMS_IC_NTC_TEMP_MIN) / BMS_IC_NTC_TEMP_STEP + 1)
+
+/**
+ * ADC codes of an NTC thermistor voltage divider at equidistant temperatures
+ */
+struct bms_ic_ntc_table
+{
+    /** ADC codes starting at BMS_IC_NTC_TEMP_MIN (strictly decreasing) */
+    uint16_t adc[BMS_IC_NTC_TABLE_SIZE];
+};
+
+/**
+ * Generate the lookup table for a thermistor based on its Beta value
+ *
+ * The thermistor is assumed to be connected between the ADC input and ground with a pull-up
+ * resistor of the same value as the thermistor's nominal resistance at 25 °C.
+ *
+ * The table only has to be generated once (e.g. during driver initialization), so the expensive
+ * floating-point calculation of the Beta equation is not needed for each measurement.
+ *
+ * @param table Pointer to the table to be filled
+ * @param beta Beta value of the thermistor (K)
+ * @param adc_full_scale ADC code corresponding to the pull-up voltage
+ */
+void bms_ic_ntc_table_init(struct bms_ic_ntc_table *table, uint16_t beta, float adc_full_scale);
+
+/**
+ * Convert ADC code to temperature using linear interpolation between the table points
+ *
+ * Only integer arithmetic is used. ADC codes outside the range of the table are clamped to the
+ * minimum or maximum temperature.
+ *
+ * @param table Pointer to the lookup table
+ * @param adc ADC code
+ *
+ * @returns temperature (0.1 °C)
+ */
+int16_t bms_ic_ntc_temp(const struct bms_ic_ntc_table *table, uint16_t adc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVERS_BMS_IC_COMMON_BMS_IC_NTC_H_ */
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "bms_ic_samples.h"
+
+#include <zephyr/sys/util.h>
+
+#define BUF_SIZE CONFIG_BMS_IC_CURRENT_SAMPLES_BUF_SIZE
+
+BUILD_ASSERT(IS_POWER_OF_TWO(BUF_SIZE), "Current sample buffer size must be a power of 2");
+
+bool bms_ic_samples_put(struct bms_ic_samples *samples, const struct bms_ic_current_sample *sample)
+{
+    atomic_val_t head = atomic_get(&samples->head);
+
+    if ((size_t)head - (size_t)atomic_get(&samples->tail) >= BUF_SIZE) {
+        return false;
+    }
+
+    samples->buf[head & (BUF_SIZE - 1)] = *sample;
+
+    /* publish the sample only after it was written completely (unsigned to wrap around) */
+    atomic_set(&samples->head, (atomic_val_t)((size_t)head + 1));
+
+    return true;
+}
+
+size_t bms_ic_samples_get(struct bms_ic_samples *samples, struct bms_ic_current_sample *out,
+                          size_t max_samples)
+{
+    atomic_val_t tail = atomic_get(&samples->tail);
+    size_t available = (size_t)atomic_get(&samples->head) - (size_t)tail;
+    size_t num = MIN(available, max_samples);
+
+    for (size_t i = 0; i < num; i++) {
+        out[i] = samples->buf[(tail + i) & (BUF_SIZE - 1)];
+    }
+
+    /* release the slots to the producer only after they were copied */
+    atomic_set(&samples->tail, (atomic_val_t)((size_t)tail + num));
+
+    return num;
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef DRIVERS_BMS_IC_COMMON_BMS_IC_SAMPLES_H_
+#define DRIVERS_BMS_IC_COMMON_BMS_IC_SAMPLES_H_
+
+/**
+ * @file
+ * @brief Lock-free buffer for timestamped current samples
+ */
+
+#include <drivers/bms_ic.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <zephyr/sys/atomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Single-producer single-consumer ring buffer of current samples
+ *
+ * The producer (typically the driver's work item handling new measurements) only writes the head
+ * index and the consumer (the application) only writes the tail index, so no locking is required.
+ * The indices are free-running and wrap at the size of the buffer, which has to be a power of 2.
+ */
+struct bms_ic_samples
+{
+    struct bms_ic_current_sample buf[CONFIG_BMS_IC_CURRENT_SAMPLES_BUF_SIZE];
+    /** Number of samples written so far (modified by producer only) */
+    atomic_t head;
+    /** Number of samples read so far (modified by consumer only) */
+    atomic_t tail;
+};
+
+/**
+ * Store a new current sample
+ *
+ * Must only be called from a single producer context.
+ *
+ * @param samples Pointer to the sample buffer
+ * @param sample Pointer to the sample to be stored
+ *
+ * @returns true if stored or false if the buffer is full (i.e. the sample was dropped)
+ */
+bool bms_ic_samples_put(struct bms_ic_samples *samples, const struct bms_ic_current_sample *sample);
+
+/**
+ * Read and remove the oldest samples from the buffer
+ *
+ * Must only be called from a single consumer context.
+ *
+ * @param samples Pointer to the sample buffer
+ * @param out Array to store the samples
+ * @param max_samples Maximum number of samples to be stored in out
+ *
+ * @returns Number of samples actually stored in out
+ */
+size_t bms_ic_samples_get(struct bms_ic_samples *samples, struct bms_ic_current_sample *out,
+                          size_t max_samples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVERS_BMS_IC_COMMON_BMS_IC_SAMPLES_H_ */
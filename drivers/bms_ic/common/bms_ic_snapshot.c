@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "bms_ic_snapshot.h"
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/sys/barrier.h>
+#include <zephyr/sys/util.h>
+
+BUILD_ASSERT(BMS_IC_DATA_ALL == GENMASK(BMS_IC_DATA_NUM_GROUPS - 1, 0),
+             "BMS_IC_DATA_NUM_GROUPS does not match BMS_IC_DATA_* flags");
+
+void bms_ic_snapshot_publish(struct bms_ic_snapshot_buf *buf, const struct bms_ic_data *ic_data,
+                             uint32_t flags)
+{
+    k_spinlock_key_t key = k_spin_lock(&buf->lock);
+    int64_t now = k_uptime_get();
+
+    uint32_t seq = (uint32_t)atomic_get(&buf->seq);
+    const struct bms_ic_snapshot *prev = &buf->slots[seq & 1];
+    struct bms_ic_snapshot *next = &buf->slots[(seq + 1) & 1];
+
+    next->data = *ic_data;
+    for (int i = 0; i < BMS_IC_DATA_NUM_GROUPS; i++) {
+        next->timestamps[i] = (flags & BIT(i)) ? now : prev->timestamps[i];
+    }
+    next->seq = seq + 1;
+
+    /* atomic_set implies a full barrier, so the slot is written completely before publishing */
+    atomic_set(&buf->seq, seq + 1);
+
+    k_spin_unlock(&buf->lock, key);
+}
+
+int bms_ic_snapshot_get(struct bms_ic_snapshot_buf *buf, struct bms_ic_snapshot *snapshot)
+{
+    uint32_t seq;
+
+    do {
+        seq = (uint32_t)atomic_get(&buf->seq);
+        if (seq == 0) {
+            return -ENODATA;
+        }
+
+        memcpy(snapshot, &buf->slots[seq & 1], sizeof(*snapshot));
+
+        /*
+         * The writer only modifies this slot after publishing the other one, i.e. after the
+         * sequence number was incremented. Make sure the copy is finished before checking.
+         */
+        barrier_dmem_fence_full();
+    } while ((uint32_t)atomic_get(&buf->seq) != seq);
+
+    return 0;
+}
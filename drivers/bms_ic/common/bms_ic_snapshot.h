@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef DRIVERS_BMS_IC_COMMON_BMS_IC_SNAPSHOT_H_
+#define DRIVERS_BMS_IC_COMMON_BMS_IC_SNAPSHOT_H_
+
+/**
+ * @file
+ * @brief Double-buffered snapshots of the BMS IC data with lock-free readers
+ */
+
+#include <drivers/bms_ic.h>
+
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Two snapshot slots protected by a sequence counter
+ *
+ * The writer always fills the slot which is not referenced by the current sequence number and
+ * publishes it by incrementing the counter afterwards. Readers copy the slot referenced by the
+ * sequence number and retry if the counter changed in the meantime, so they never block the
+ * writer. Concurrent writers (e.g. main thread and work items of the same driver) are serialized
+ * by a spinlock, which is never taken by readers.
+ *
+ * The writer copies the data object passed to bms_ic_snapshot_publish(), so the driver must make
+ * sure that it is not modified by another context during decoding and publishing (e.g. by holding
+ * its own lock for the entire read).
+ */
+struct bms_ic_snapshot_buf
+{
+    struct bms_ic_snapshot slots[2];
+    /** Number of snapshots published so far, the latest one is stored in slots[seq & 1] */
+    atomic_t seq;
+    /** Serializes writers only */
+    struct k_spinlock lock;
+};
+
+/**
+ * Publish a copy of the current BMS IC data
+ *
+ * @param buf Pointer to the snapshot buffer
+ * @param ic_data Pointer to the data to be copied
+ * @param flags BMS_IC_DATA_* flags of the groups updated since the previous snapshot (used to
+ *              set the timestamps)
+ */
+void bms_ic_snapshot_publish(struct bms_ic_snapshot_buf *buf, const struct bms_ic_data *ic_data,
+                             uint32_t flags);
+
+/**
+ * Copy the latest published snapshot
+ *
+ * Never blocks and may be called from any thread concurrently to the writer.
+ *
+ * @param buf Pointer to the snapshot buffer
+ * @param snapshot Pointer to store the copy
+ *
+ * @retval 0 for success
+ * @retval -ENODATA if no snapshot was published yet
+ */
+int bms_ic_snapshot_get(struct bms_ic_snapshot_buf *buf, struct bms_ic_snapshot *snapshot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVERS_BMS_IC_COMMON_BMS_IC_SNAPSHOT_H_ */
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "bms_ic_sw_protection.h"
+
+#include <string.h>
+
+bool bms_ic_sw_protection_update(struct bms_ic_sw_protection *prot, bool exceeded,
+                                 uint32_t delay_ms, uint32_t recovery_ms, int64_t now)
+{
+    if (!exceeded) {
+        prot->exceeded = false;
+        if (prot->tripped && now - prot->tripped_since >= recovery_ms) {
+            prot->tripped = false;
+        }
+        return false;
+    }
+
+    if (!prot->exceeded) {
+        prot->exceeded = true;
+        prot->exceeded_since = now;
+    }
+
+    if (!prot->tripped && now - prot->exceeded_since >= delay_ms) {
+        prot->tripped = true;
+        prot->tripped_since = now;
+        return true;
+    }
+
+    return false;
+}
+
+void bms_ic_sw_protection_reset(struct bms_ic_sw_protection *prot)
+{
+    memset(prot, 0, sizeof(*prot));
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef DRIVERS_BMS_IC_COMMON_BMS_IC_SW_PROTECTION_H_
+#define DRIVERS_BMS_IC_COMMON_BMS_IC_SW_PROTECTION_H_
+
+/**
+ * @file
+ * @brief Debouncing and latching of protections implemented in software
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * State of a protection implemented in software because it is not supported by the IC
+ */
+struct bms_ic_sw_protection
+{
+    /** Uptime when the limit was exceeded the first time (ms) */
+    int64_t exceeded_since;
+    /** Uptime when the protection tripped (ms) */
+    int64_t tripped_since;
+    /** Set as long as the limit is exceeded */
+    bool exceeded;
+    /** Set after the limit was exceeded longer than the delay, latched until recovery */
+    bool tripped;
+};
+
+/**
+ * Update the protection state with a new measurement
+ *
+ * The protection trips if the limit was exceeded for longer than the delay. It stays tripped
+ * (latched) until the limit is not exceeded anymore and the recovery delay since the trip has
+ * passed, so that the application notices the error even though the measurement goes back to
+ * normal as soon as the corresponding switch is turned off.
+ *
+ * @param prot Pointer to the protection state
+ * @param exceeded True if the latest measurement exceeds the limit
+ * @param delay_ms Time the limit has to be exceeded before the protection trips (ms)
+ * @param recovery_ms Minimum time the protection stays tripped (ms)
+ * @param now Current uptime (ms)
+ *
+ * @returns true if the protection tripped with this measurement, false otherwise
+ */
+bool bms_ic_sw_protection_update(struct bms_ic_sw_protection *prot, bool exceeded,
+                                 uint32_t delay_ms, uint32_t recovery_ms, int64_t now);
+
+/**
+ * Reset the protection state, e.g. after the limits were changed by the application
+ *
+ * @param prot Pointer to the protection state
+ */
+void bms_ic_sw_protection_reset(struct bms_ic_sw_protection *prot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVERS_BMS_IC_COMMON_BMS_IC_SW_PROTECTION_H_ */
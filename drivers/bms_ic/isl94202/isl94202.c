@@ -9,6 +9,7 @@
 #include <bms/bms_common.h>
 #include <drivers/bms_ic.h>
 
+#include "bms_ic_balancing.h"
 #include "isl94202_interface.h"
 #include "isl94202_priv.h"
 #include "isl94202_registers.h"
@@ -31,6 +32,17 @@
 
 LOG_MODULE_REGISTER(bms_ic_isl94202, CONFIG_BMS_IC_LOG_LEVEL);
 
+/* RAM block with status, control and ADC result registers read in one transfer */
+#define ISL94202_REGS_START ISL94202_STAT0
+#define ISL94202_REGS_SIZE  (ISL94202_XT2 + 1 - ISL94202_STAT0 + 1)
+
+/* STAT3 bits indicating the operating mode, which determines the ADC scan intervals */
+#define ISL94202_SCAN_MODE_Msk \
+    (ISL94202_STAT3_INIDLE_Msk | ISL94202_STAT3_INDOZE_Msk | ISL94202_STAT3_INSLEEP_Msk)
+
+/* below the duration of an ADC scan (max. 1.7 ms) to detect its end */
+#define ISL94202_STARTUP_POLL_INTERVAL_MS (1)
+
 /* Lookup-table for temperatures according to datasheet */
 static const float lut_temp_volt[] = { 0.153, 0.295, 0.463, 0.710, 0.755 };
 static const float lut_temp_degc[] = { 80, 50, 25, 0, -40 };
@@ -61,11 +73,7 @@ static int set_num_cells(const struct device *dev, int num)
             break;
     }
 
-    // ToDo: Double write for certain bytes (see datasheet 7.1.10) --> move this to _hw.c file
-    // k_sleep(30);
-    // isl94202_write_bytes(dev, ISL94202_MOD_CELL + 1, &cell_reg, 1);
-    // k_sleep(30);
-
+    /* double write according to datasheet 7.1.10 is done by isl94202_write_bytes */
     return isl94202_write_bytes(dev, ISL94202_MOD_CELL + 1, &cell_reg, 1);
 }
 
@@ -131,6 +139,14 @@ static int isl94202_configure_temp_limits(const struct device *dev, struct bms_i
     float adc_voltage;
     int err = 0;
 
+#ifdef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+
+    /* the internal balancing state machine is not used, so the limits are checked in software */
+    dev_data->bal_temp_min = ic_conf->chg_ut_limit;
+    dev_data->bal_temp_max = ic_conf->chg_ot_limit;
+#endif
+
     // Charge over-temperature
     adc_voltage =
         interpolate(lut_temp_degc, lut_temp_volt, ARRAY_SIZE(lut_temp_degc), ic_conf->chg_ot_limit);
@@ -178,10 +194,39 @@ static int isl94202_configure_temp_limits(const struct device *dev, struct bms_i
     return err == 0 ? 0 : -EIO;
 }
 
+#ifdef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+
+static int isl94202_set_balancing_switches(const struct device *dev, uint32_t cells)
+{
+    const struct bms_ic_isl94202_config *dev_config = dev->config;
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+    uint8_t reg = 0;
+    int cell_index = 0;
+    int err;
+
+    /* CBFC bits correspond to the cell channels, which may include unused channels */
+    for (int i = 0; i < 8; i++) {
+        if (dev_config->used_cell_channels & BIT(i)) {
+            if (cells & BIT(cell_index)) {
+                reg |= BIT(i);
+            }
+            cell_index++;
+        }
+    }
+
+    err = isl94202_write_bytes(dev, ISL94202_CBFC, &reg, 1);
+    if (err == 0) {
+        dev_data->balancing_status = cells;
+    }
+
+    return err;
+}
+
+#endif /* CONFIG_BMS_IC_ISL94202_SW_BALANCING */
+
 static int isl94202_configure_balancing(const struct device *dev, struct bms_ic_conf *ic_conf)
 {
     struct bms_ic_isl94202_data *dev_data = dev->data;
-    struct k_work_sync work_sync;
     uint8_t reg;
     int err = 0;
 
@@ -196,25 +241,45 @@ static int isl94202_configure_balancing(const struct device *dev, struct bms_ic_
     // enable balancing during idle
     err |= isl94202_write_voltage(dev, ISL94202_EOC, ic_conf->bal_cell_voltage_min, 0);
 
+#ifdef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+    dev_data->bal_cell_voltage_min = ic_conf->bal_cell_voltage_min;
+    dev_data->bal_cell_voltage_diff = ic_conf->bal_cell_voltage_diff;
+    dev_data->bal_idle_current = ic_conf->bal_idle_current;
+    dev_data->bal_idle_delay = ic_conf->bal_idle_delay;
+    dev_data->balancing_plan_valid = false;
+#endif
+
     if (ic_conf->auto_balancing) {
+#ifdef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+        // Cells are selected by the driver, so the internal balancing state machine stays off
+        reg = 0;
+#else
         // Enable automatic balancing during charging and EOC conditions
         reg = ISL94202_SETUP1_CBDC_Msk | ISL94202_SETUP1_CB_EOC_Msk;
+#endif
         err |= isl94202_write_bytes(dev, ISL94202_SETUP1, &reg, 1);
-        // Start work handler to adjust balancing timings depending on operation mode
+        // Start work handler to adjust balancing depending on operation mode
         k_work_schedule(&dev_data->balancing_work, K_NO_WAIT);
+#ifndef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+        dev_data->balancing_mode_checked = k_uptime_get();
+#endif
     }
     else {
         // Disable balancing
         reg = 0;
         err |= isl94202_write_bytes(dev, ISL94202_SETUP1, &reg, 1);
-        k_work_cancel_delayable_sync(&dev_data->balancing_work, &work_sync);
+        /* not waiting for completion, as the work handler needs the lock held by the caller */
+        k_work_cancel_delayable(&dev_data->balancing_work);
+#ifdef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+        err |= isl94202_set_balancing_switches(dev, 0);
+#endif
     }
     dev_data->auto_balancing = ic_conf->auto_balancing;
 
     return err == 0 ? 0 : -EIO;
 }
 
-static int bms_ic_isl94202_configure(const struct device *dev, struct bms_ic_conf *ic_conf,
+static int isl94202_configure_nolock(const struct device *dev, struct bms_ic_conf *ic_conf,
                                      uint32_t flags)
 {
     uint32_t actual_flags = 0;
@@ -252,7 +317,58 @@ static int bms_ic_isl94202_configure(const struct device *dev, struct bms_ic_con
     return (actual_flags != 0) ? actual_flags : -ENOTSUP;
 }
 
-static int isl94202_read_voltages(const struct device *dev, struct bms_ic_data *ic_data)
+static int bms_ic_isl94202_configure(const struct device *dev, struct bms_ic_conf *ic_conf,
+                                     uint32_t flags)
+{
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+
+    k_mutex_lock(&dev_data->lock, K_FOREVER);
+    int ret = isl94202_configure_nolock(dev, ic_conf, flags);
+    k_mutex_unlock(&dev_data->lock);
+
+    return ret;
+}
+
+/*
+ * Status, control and ADC result registers are located in one contiguous RAM block, so all
+ * measurements of a scan can be fetched with a single I2C transfer.
+ */
+static int isl94202_read_regs(const struct device *dev, uint32_t flags, uint8_t *regs)
+{
+    uint8_t last_reg;
+
+    /* the burst ends at the last register actually needed for the requested data */
+    if (flags & BMS_IC_DATA_TEMPERATURES) {
+        last_reg = ISL94202_XT2 + 1;
+    }
+    else if (flags & (BMS_IC_DATA_CELL_VOLTAGES | BMS_IC_DATA_PACK_VOLTAGES)) {
+        last_reg = ISL94202_CELL8 + 1;
+    }
+    else if (flags & (BMS_IC_DATA_CURRENT | BMS_IC_DATA_CHARGE)) {
+        last_reg = ISL94202_ISNS + 1;
+    }
+    else {
+        last_reg = ISL94202_CTRL1;
+    }
+
+    return isl94202_read_bytes(dev, ISL94202_REGS_START, regs,
+                               last_reg - ISL94202_REGS_START + 1);
+}
+
+static inline uint8_t isl94202_regs_get_byte(const uint8_t *regs, uint8_t reg_addr)
+{
+    return regs[reg_addr - ISL94202_REGS_START];
+}
+
+static inline uint16_t isl94202_regs_get_adc(const uint8_t *regs, uint8_t reg_addr)
+{
+    const uint8_t *reg = regs + reg_addr - ISL94202_REGS_START;
+
+    return (reg[0] | reg[1] << 8) & 0x0FFF;
+}
+
+static int isl94202_decode_voltages(const struct device *dev, struct bms_ic_data *ic_data,
+                                    const uint8_t *regs)
 {
     const struct bms_ic_isl94202_config *dev_config = dev->config;
     uint16_t adc_raw = 0;
@@ -267,8 +383,7 @@ static int isl94202_read_voltages(const struct device *dev, struct bms_ic_data *
                 return -EINVAL;
             }
 
-            isl94202_read_word(dev, ISL94202_CELL1 + i * 2, &adc_raw);
-            adc_raw &= 0x0FFF;
+            adc_raw = isl94202_regs_get_adc(regs, ISL94202_CELL1 + i * 2);
             ic_data->cell_voltages[cell_index] = (float)adc_raw * 18 * 800 / 4095 / 3 / 1000;
 
             if (cell_index == 0) {
@@ -301,22 +416,26 @@ static int isl94202_read_voltages(const struct device *dev, struct bms_ic_data *
     // VBATT based pack voltage seems very inaccurate, so take sum of cell voltages instead
     ic_data->total_voltage = sum_voltages;
 
+#ifdef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+    /* cell selection for balancing has to be updated */
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+    dev_data->balancing_plan_valid = false;
+#endif
+
     return 0;
 }
 
 // using default setting TGain = 0 (GAIN = 2) with 22k resistors
-static int isl94202_read_temperatures(const struct device *dev, struct bms_ic_data *ic_data)
+static void isl94202_decode_temperatures(struct bms_ic_data *ic_data, const uint8_t *regs)
 {
     uint16_t adc_raw;
 
     // Internal temperature
-    isl94202_read_word(dev, ISL94202_IT, &adc_raw);
-    adc_raw &= 0x0FFF;
+    adc_raw = isl94202_regs_get_adc(regs, ISL94202_IT);
     ic_data->ic_temp = (float)adc_raw * 1.8F / 4095 * 1000 / 1.8527F - 273.15F;
 
     // External temperature 1
-    isl94202_read_word(dev, ISL94202_XT1, &adc_raw);
-    adc_raw &= 0x0FFF;
+    adc_raw = isl94202_regs_get_adc(regs, ISL94202_XT1);
     float adc_v = (float)adc_raw * 1.8F / 4095 / 2;
 
     ic_data->cell_temp_avg =
@@ -327,96 +446,101 @@ static int isl94202_read_temperatures(const struct device *dev, struct bms_ic_da
     ic_data->cell_temp_max = ic_data->cell_temp_avg;
 
     // External temperature 2 (used for MOSFET temperature sensing)
-    isl94202_read_word(dev, ISL94202_XT2, &adc_raw);
-    adc_raw &= 0x0FFF;
+    adc_raw = isl94202_regs_get_adc(regs, ISL94202_XT2);
     adc_v = (float)adc_raw * 1.8F / 4095 / 2;
 
     ic_data->mosfet_temp =
         interpolate(lut_temp_volt, lut_temp_degc, ARRAY_SIZE(lut_temp_degc), adc_v);
-
-    return 0;
 }
 
 #ifdef CONFIG_BMS_IC_CURRENT_MONITORING
 
-static int isl94202_read_current(const struct device *dev, struct bms_ic_data *ic_data)
+static void isl94202_decode_current(const struct device *dev, struct bms_ic_data *ic_data,
+                                    const uint8_t *regs)
 {
     const struct bms_ic_isl94202_config *dev_config = dev->config;
-    uint8_t buf[2];
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+    uint8_t reg;
 
     // gain
-    isl94202_read_bytes(dev, ISL94202_CTRL0, buf, 1);
-    uint8_t gain_reg = (buf[0] & ISL94202_CTRL0_CG_Msk) >> ISL94202_CTRL0_CG_Pos;
+    reg = isl94202_regs_get_byte(regs, ISL94202_CTRL0);
+    uint8_t gain_reg = (reg & ISL94202_CTRL0_CG_Msk) >> ISL94202_CTRL0_CG_Pos;
     int gain = gain_reg < 3 ? isl94202_current_gains[gain_reg] : 500;
 
     // direction / sign
     int sign = 0;
-    isl94202_read_bytes(dev, ISL94202_STAT2, buf, 1);
-    sign += (buf[0] & ISL94202_STAT2_CHING_Msk) >> ISL94202_STAT2_CHING_Pos;
-    sign -= (buf[0] & ISL94202_STAT2_DCHING_Msk) >> ISL94202_STAT2_DCHING_Pos;
+    reg = isl94202_regs_get_byte(regs, ISL94202_STAT2);
+    sign += (reg & ISL94202_STAT2_CHING_Msk) >> ISL94202_STAT2_CHING_Pos;
+    sign -= (reg & ISL94202_STAT2_DCHING_Msk) >> ISL94202_STAT2_DCHING_Pos;
 
     // ADC value
-    uint16_t adc_raw;
-    isl94202_read_word(dev, ISL94202_ISNS, &adc_raw);
-    adc_raw &= 0x0FFF;
+    uint16_t adc_raw = isl94202_regs_get_adc(regs, ISL94202_ISNS);
 
     ic_data->current =
         (float)(sign * adc_raw * 1800) / (4095 * gain * dev_config->shunt_resistor_uohm) * 1000;
+    ic_data->current_avg = ic_data->current;
 
-    return 0;
+    /* no passed charge accumulator in the IC, so the current is integrated in software */
+    bms_ic_charge_counter_update(&dev_data->charge_counter, ic_data, k_uptime_get());
+
+#ifdef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+    if (fabsf(ic_data->current) > dev_data->bal_idle_current) {
+        dev_data->active_timestamp = k_uptime_get();
+    }
+#endif
 }
 
 #endif /* CONFIG_BMS_IC_CURRENT_MONITORING */
 
-static int isl94202_read_balancing(const struct device *dev, struct bms_ic_data *ic_data)
+static void isl94202_decode_balancing(const struct device *dev, struct bms_ic_data *ic_data,
+                                      const uint8_t *regs)
 {
+#ifdef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+
+    ic_data->balancing_status = dev_data->balancing_status;
+#else
     /*
      * Balancing is done automatically, just reading status here (even though the datasheet
      * tells that the CBFC register value cannot be used for indication if a cell is
      * balanced at the moment)
      */
-
-    uint8_t reg = 0;
-    isl94202_read_bytes(dev, ISL94202_CBFC, &reg, 1);
-
-    ic_data->balancing_status = reg;
-
-    return 0;
+    ic_data->balancing_status = isl94202_regs_get_byte(regs, ISL94202_CBFC);
+#endif
 }
 
-static int isl94202_read_error_flags(const struct device *dev, struct bms_ic_data *ic_data)
+static void isl94202_decode_error_flags(const struct device *dev, struct bms_ic_data *ic_data,
+                                        const uint8_t *regs)
 {
     struct bms_ic_isl94202_data *dev_data = dev->data;
     uint32_t error_flags = 0;
-    uint8_t stat[2];
-    uint8_t ctrl1;
+    uint8_t stat0 = isl94202_regs_get_byte(regs, ISL94202_STAT0);
+    uint8_t stat1 = isl94202_regs_get_byte(regs, ISL94202_STAT1);
+    uint8_t ctrl1 = isl94202_regs_get_byte(regs, ISL94202_CTRL1);
 
-    isl94202_read_bytes(dev, ISL94202_STAT0, stat, 2);
-    isl94202_read_bytes(dev, ISL94202_CTRL1, &ctrl1, 1);
-
-    if (stat[0] & ISL94202_STAT0_UVF_Msk)
+    if (stat0 & ISL94202_STAT0_UVF_Msk)
         error_flags |= BMS_ERR_CELL_UNDERVOLTAGE;
-    if (stat[0] & ISL94202_STAT0_OVF_Msk)
+    if (stat0 & ISL94202_STAT0_OVF_Msk)
         error_flags |= BMS_ERR_CELL_OVERVOLTAGE;
-    if (stat[1] & ISL94202_STAT1_DSCF_Msk)
+    if (stat1 & ISL94202_STAT1_DSCF_Msk)
         error_flags |= BMS_ERR_SHORT_CIRCUIT;
-    if (stat[1] & ISL94202_STAT1_DOCF_Msk)
+    if (stat1 & ISL94202_STAT1_DOCF_Msk)
         error_flags |= BMS_ERR_DIS_OVERCURRENT;
-    if (stat[1] & ISL94202_STAT1_COCF_Msk)
+    if (stat1 & ISL94202_STAT1_COCF_Msk)
         error_flags |= BMS_ERR_CHG_OVERCURRENT;
-    if (stat[1] & ISL94202_STAT1_OPENF_Msk)
+    if (stat1 & ISL94202_STAT1_OPENF_Msk)
         error_flags |= BMS_ERR_OPEN_WIRE;
-    if (stat[0] & ISL94202_STAT0_DUTF_Msk)
+    if (stat0 & ISL94202_STAT0_DUTF_Msk)
         error_flags |= BMS_ERR_DIS_UNDERTEMP;
-    if (stat[0] & ISL94202_STAT0_DOTF_Msk)
+    if (stat0 & ISL94202_STAT0_DOTF_Msk)
         error_flags |= BMS_ERR_DIS_OVERTEMP;
-    if (stat[0] & ISL94202_STAT0_CUTF_Msk)
+    if (stat0 & ISL94202_STAT0_CUTF_Msk)
         error_flags |= BMS_ERR_CHG_UNDERTEMP;
-    if (stat[0] & ISL94202_STAT0_COTF_Msk)
+    if (stat0 & ISL94202_STAT0_COTF_Msk)
         error_flags |= BMS_ERR_CHG_OVERTEMP;
-    if (stat[1] & ISL94202_STAT1_IOTF_Msk)
+    if (stat1 & ISL94202_STAT1_IOTF_Msk)
         error_flags |= BMS_ERR_INT_OVERTEMP;
-    if (stat[1] & ISL94202_STAT1_CELLF_Msk)
+    if (stat1 & ISL94202_STAT1_CELLF_Msk)
         error_flags |= BMS_ERR_CELL_FAILURE;
 
     if (!(ctrl1 & ISL94202_CTRL1_DFET_Msk) && (dev_data->fet_state & BMS_SWITCH_DIS)) {
@@ -428,14 +552,49 @@ static int isl94202_read_error_flags(const struct device *dev, struct bms_ic_dat
     }
 
     ic_data->error_flags = error_flags;
+}
 
-    return 0;
+/*
+ * The balancing work is only triggered by events which may change the balancing: New cell
+ * voltages for the driver-based cell selection or a change of the IC's operating mode (caused by
+ * the current) for the balancing timing. STAT3 is part of every burst read, so detecting the mode
+ * change does not need any additional bus transfer.
+ */
+static void isl94202_trigger_balancing(const struct device *dev, uint32_t flags,
+                                       const uint8_t *regs)
+{
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+
+    if (!dev_data->auto_balancing) {
+        return;
+    }
+
+#ifdef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+    if (flags & (BMS_IC_DATA_CELL_VOLTAGES | BMS_IC_DATA_PACK_VOLTAGES)) {
+        k_work_reschedule(&dev_data->balancing_work, K_NO_WAIT);
+    }
+#else
+    uint8_t scan_mode = isl94202_regs_get_byte(regs, ISL94202_STAT3) & ISL94202_SCAN_MODE_Msk;
+    int64_t now = k_uptime_get();
+
+    if (atomic_set(&dev_data->balancing_scan_mode, scan_mode) != scan_mode) {
+        k_work_reschedule(&dev_data->balancing_work, K_NO_WAIT);
+        dev_data->balancing_mode_checked = now;
+    }
+    else {
+        /* STAT3 reads of the former 1 s polling avoided since the last check */
+        int64_t avoided = (now - dev_data->balancing_mode_checked) / 1000;
+        dev_data->skipped_transfers += avoided;
+        dev_data->balancing_mode_checked += avoided * 1000;
+    }
+#endif
 }
 
-static int bms_ic_isl94202_read_data(const struct device *dev, uint32_t flags)
+static int isl94202_read_data_nolock(const struct device *dev, uint32_t flags)
 {
     struct bms_ic_isl94202_data *dev_data = dev->data;
     struct bms_ic_data *ic_data = dev_data->ic_data;
+    uint8_t regs[ISL94202_REGS_SIZE];
     uint32_t actual_flags = 0;
     int err = 0;
 
@@ -443,40 +602,80 @@ static int bms_ic_isl94202_read_data(const struct device *dev, uint32_t flags)
         return -ENOMEM;
     }
 
+    if (flags == 0) {
+        return 0;
+    }
+
+    err = isl94202_read_regs(dev, flags, regs);
+    if (err != 0) {
+        return -EIO;
+    }
+
     if (flags & (BMS_IC_DATA_CELL_VOLTAGES | BMS_IC_DATA_PACK_VOLTAGES)) {
-        err |= isl94202_read_voltages(dev, ic_data);
+        err |= isl94202_decode_voltages(dev, ic_data, regs);
         actual_flags |= ((BMS_IC_DATA_CELL_VOLTAGES | BMS_IC_DATA_PACK_VOLTAGES) & flags);
     }
 
     if (flags & BMS_IC_DATA_TEMPERATURES) {
-        err |= isl94202_read_temperatures(dev, ic_data);
+        isl94202_decode_temperatures(ic_data, regs);
         actual_flags |= BMS_IC_DATA_TEMPERATURES;
     }
 
 #ifdef CONFIG_BMS_IC_CURRENT_MONITORING
-    if (flags & BMS_IC_DATA_CURRENT) {
-        err |= isl94202_read_current(dev, ic_data);
-        actual_flags |= BMS_IC_DATA_CURRENT;
+    if (flags & (BMS_IC_DATA_CURRENT | BMS_IC_DATA_CHARGE)) {
+        /* charge is integrated from the current, so the current is decoded in both cases */
+        isl94202_decode_current(dev, ic_data, regs);
+        actual_flags |= ((BMS_IC_DATA_CURRENT | BMS_IC_DATA_CHARGE) & flags);
     }
 #endif /* CONFIG_BMS_IC_CURRENT_MONITORING */
 
     if (flags & BMS_IC_DATA_BALANCING) {
-        err |= isl94202_read_balancing(dev, ic_data);
+        isl94202_decode_balancing(dev, ic_data, regs);
         actual_flags |= BMS_IC_DATA_BALANCING;
     }
 
     if (flags & BMS_IC_DATA_ERROR_FLAGS) {
-        err |= isl94202_read_error_flags(dev, ic_data);
+        isl94202_decode_error_flags(dev, ic_data, regs);
         actual_flags |= BMS_IC_DATA_ERROR_FLAGS;
     }
 
+    isl94202_trigger_balancing(dev, flags, regs);
+
     if (err != 0) {
         return -EIO;
     }
 
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+    bms_ic_snapshot_publish(&dev_data->snapshot, ic_data, actual_flags);
+#endif
+
     return (flags == actual_flags) ? 0 : -EINVAL;
 }
 
+/* the data may also be read asynchronously from the system work queue */
+static int bms_ic_isl94202_read_data(const struct device *dev, uint32_t flags)
+{
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+
+    k_mutex_lock(&dev_data->lock, K_FOREVER);
+    int err = isl94202_read_data_nolock(dev, flags);
+    k_mutex_unlock(&dev_data->lock);
+
+    return err;
+}
+
+#ifdef CONFIG_BMS_IC_ASYNC
+
+static int bms_ic_isl94202_read_data_async(const struct device *dev, uint32_t flags,
+                                           struct k_poll_signal *signal)
+{
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+
+    return bms_ic_async_read_submit(&dev_data->async_read, flags, signal);
+}
+
+#endif /* CONFIG_BMS_IC_ASYNC */
+
 static void bms_ic_isl94202_assign_data(const struct device *dev, struct bms_ic_data *ic_data)
 {
     struct bms_ic_isl94202_data *dev_data = dev->data;
@@ -495,6 +694,8 @@ static int bms_ic_isl94202_set_switches(const struct device *dev, uint8_t switch
         return -EINVAL;
     }
 
+    k_mutex_lock(&dev_data->lock, K_FOREVER);
+
     isl94202_read_bytes(dev, ISL94202_CTRL1, &reg, 1);
 
     if (switches & BMS_SWITCH_CHG) {
@@ -518,7 +719,11 @@ static int bms_ic_isl94202_set_switches(const struct device *dev, uint8_t switch
         }
     }
 
-    return isl94202_write_bytes(dev, ISL94202_CTRL1, &reg, 1);
+    int err = isl94202_write_bytes(dev, ISL94202_CTRL1, &reg, 1);
+
+    k_mutex_unlock(&dev_data->lock);
+
+    return err;
 }
 
 #endif /* CONFIG_BMS_IC_SWITCHES */
@@ -546,15 +751,71 @@ static int bms_ic_isl94202_debug_print_mem(const struct device *dev)
     return 0;
 }
 
-static void isl94202_balancing_work_handler(struct k_work *work)
+#ifdef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+
+static void isl94202_update_balancing(const struct device *dev)
 {
-    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
-    struct bms_ic_isl94202_data *dev_data =
-        CONTAINER_OF(dwork, struct bms_ic_isl94202_data, balancing_work);
-    const struct device *dev = dev_data->dev;
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+    struct bms_ic_data *ic_data = dev_data->ic_data;
+    int err;
 
-    uint8_t stat3;
-    isl94202_read_bytes(dev, ISL94202_STAT3, &stat3, 1);
+    if (ic_data == NULL) {
+        return;
+    }
+
+    /* balancing only after the battery was idle for some time and within charging temperatures */
+    bool balancing_needed =
+        k_uptime_get() - dev_data->active_timestamp >= dev_data->bal_idle_delay * 1000LL
+        && ic_data->cell_temp_min > dev_data->bal_temp_min
+        && ic_data->cell_temp_max < dev_data->bal_temp_max
+        && ic_data->cell_voltage_max > dev_data->bal_cell_voltage_min
+        && (ic_data->cell_voltage_max - ic_data->cell_voltage_min)
+               > dev_data->bal_cell_voltage_diff;
+
+    if (balancing_needed) {
+        /* the selection only changes with new cell voltages, so it is not repeated otherwise */
+        if (!dev_data->balancing_plan_valid) {
+            uint32_t cells = bms_ic_balancing_plan(
+                ic_data->cell_voltages, CONFIG_BMS_IC_ISL94202_NUM_CELLS,
+                ic_data->cell_voltage_min + dev_data->bal_cell_voltage_diff);
+
+            err = isl94202_set_balancing_switches(dev, cells);
+            if (err == 0) {
+                LOG_DBG("Set CBFC for cells 0x%02X", cells);
+                dev_data->balancing_plan_valid = true;
+            }
+            else {
+                LOG_ERR("Failed to set CBFC register: %d", err);
+            }
+        }
+    }
+    else if (dev_data->balancing_status != 0) {
+        err = isl94202_set_balancing_switches(dev, 0);
+        if (err != 0) {
+            LOG_ERR("Clearing CBFC register failed: %d", err);
+        }
+        dev_data->balancing_plan_valid = false;
+    }
+}
+
+#else
+
+static void isl94202_update_balancing_timing(const struct device *dev)
+{
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+
+    atomic_val_t scan_mode = atomic_get(&dev_data->balancing_scan_mode);
+    uint8_t stat3 = scan_mode;
+    int err = 0;
+
+    if (stat3 == ISL94202_SCAN_MODE_UNKNOWN) {
+        err = isl94202_read_bytes(dev, ISL94202_STAT3, &stat3, 1);
+        if (err != 0) {
+            LOG_ERR("Failed to read STAT3 register: %d", err);
+            k_work_reschedule(&dev_data->balancing_work, K_SECONDS(1));
+            return;
+        }
+    }
 
     /*
      * System scans for voltage, current and temperature measurements happen in different
@@ -564,25 +825,111 @@ static void isl94202_balancing_work_handler(struct k_work *work)
      */
     if (stat3 & ISL94202_STAT3_INIDLE_Msk) {
         /* IDLE mode: Scan every 256 ms */
-        isl94202_write_delay(dev, ISL94202_CBONT, ISL94202_DELAY_MS, 240, 0);
+        err |= isl94202_write_delay(dev, ISL94202_CBONT, ISL94202_DELAY_MS, 240, 0);
     }
     else if (stat3 & ISL94202_STAT3_INDOZE_Msk) {
         /* DOZE mode: Scan every 512 ms */
-        isl94202_write_delay(dev, ISL94202_CBONT, ISL94202_DELAY_MS, 496, 0);
+        err |= isl94202_write_delay(dev, ISL94202_CBONT, ISL94202_DELAY_MS, 496, 0);
     }
     else if (!(stat3 & ISL94202_STAT3_INSLEEP_Msk)) {
         /* NORMAL mode: Scan every 32 ms */
-        isl94202_write_delay(dev, ISL94202_CBONT, ISL94202_DELAY_MS, 16, 0);
+        err |= isl94202_write_delay(dev, ISL94202_CBONT, ISL94202_DELAY_MS, 16, 0);
     }
-    isl94202_write_delay(dev, ISL94202_CBOFFT, ISL94202_DELAY_MS, 16, 0);
+    err |= isl94202_write_delay(dev, ISL94202_CBOFFT, ISL94202_DELAY_MS, 16, 0);
 
-    k_work_reschedule(dwork, K_SECONDS(1));
+    /*
+     * The mode is only updated if read_data did not detect a change in the meantime, as the work
+     * was already resubmitted in that case.
+     */
+    if (err == 0) {
+        atomic_cas(&dev_data->balancing_scan_mode, scan_mode, stat3 & ISL94202_SCAN_MODE_Msk);
+    }
+    else {
+        LOG_ERR("Failed to set balancing timing");
+        if (atomic_cas(&dev_data->balancing_scan_mode, scan_mode, ISL94202_SCAN_MODE_UNKNOWN)) {
+            k_work_reschedule(&dev_data->balancing_work, K_SECONDS(1));
+        }
+    }
+}
+
+#endif /* CONFIG_BMS_IC_ISL94202_SW_BALANCING */
+
+static void isl94202_balancing_work_handler(struct k_work *work)
+{
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct bms_ic_isl94202_data *dev_data =
+        CONTAINER_OF(dwork, struct bms_ic_isl94202_data, balancing_work);
+    const struct device *dev = dev_data->dev;
+
+    k_mutex_lock(&dev_data->lock, K_FOREVER);
+
+    /* balancing may have been disabled while this work was already pending */
+    if (dev_data->auto_balancing) {
+#ifdef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+        isl94202_update_balancing(dev);
+#else
+        isl94202_update_balancing_timing(dev);
+#endif
+    }
+
+    k_mutex_unlock(&dev_data->lock);
 }
 
 static int bms_ic_isl94202_balance(const struct device *dev, uint32_t cells)
 {
-    /* manual balancing not yet supported */
+#ifdef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+
+    if (dev_data->auto_balancing) {
+        return -EBUSY;
+    }
+
+    if (cells >= BIT(CONFIG_BMS_IC_ISL94202_NUM_CELLS)) {
+        return -EINVAL;
+    }
+
+    k_mutex_lock(&dev_data->lock, K_FOREVER);
+    int err = isl94202_set_balancing_switches(dev, cells);
+    k_mutex_unlock(&dev_data->lock);
+
+    return err == 0 ? 0 : -EIO;
+#else
+    /* manual balancing only supported if the driver controls the balancing FETs */
     return -ENOTSUP;
+#endif
+}
+
+/*
+ * The IC does not respond via I2C before the wake-up from shutdown or initial power-up is
+ * completed. Afterwards, the INTSCAN flag indicates an internal ADC scan in progress. The
+ * measurement registers are only valid after a scan finished, so the IC is considered ready as
+ * soon as the flag was seen to be cleared again. A missed scan only delays the detection until
+ * the next scan.
+ */
+static int isl94202_wait_ready(const struct device *dev)
+{
+    int64_t timeout = k_uptime_get() + CONFIG_BMS_IC_ISL94202_STARTUP_TIMEOUT_MS;
+    bool scan_seen = false;
+    uint8_t stat2;
+    int err;
+
+    while (true) {
+        err = isl94202_read_bytes(dev, ISL94202_STAT2, &stat2, 1);
+        if (err == 0) {
+            if (stat2 & ISL94202_STAT2_INTSCAN_Msk) {
+                scan_seen = true;
+            }
+            else if (scan_seen) {
+                return 0;
+            }
+        }
+
+        if (k_uptime_get() >= timeout) {
+            return -ETIMEDOUT;
+        }
+
+        k_sleep(K_MSEC(ISL94202_STARTUP_POLL_INTERVAL_MS));
+    }
 }
 
 static int isl94202_activate(const struct device *dev)
@@ -591,12 +938,22 @@ static int isl94202_activate(const struct device *dev)
     uint8_t reg;
     int err;
 
-    /* Datasheet: 3 seconds wake-up delay from shutdown or initial power-up */
-    k_sleep(K_TIMEOUT_ABS_MS(3000));
-
     /* activate pull-up at I2C SDA and SCL */
     gpio_pin_configure_dt(&dev_config->i2c_pullup, GPIO_OUTPUT_ACTIVE);
 
+    /* configuration registers are reloaded from EEPROM after power-up or wake-up */
+    isl94202_config_shadow_invalidate(dev);
+#ifndef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+    atomic_set(&dev_data->balancing_scan_mode, ISL94202_SCAN_MODE_UNKNOWN);
+#endif
+
+    err = isl94202_wait_ready(dev);
+    if (err) {
+        LOG_ERR("ISL94202 not ready after %d ms", CONFIG_BMS_IC_ISL94202_STARTUP_TIMEOUT_MS);
+        return err;
+    }
+
     err = set_num_cells(dev, CONFIG_BMS_IC_ISL94202_NUM_CELLS);
     if (err) {
         LOG_ERR("Failed to set number of cells: %d", err);
@@ -613,6 +970,10 @@ static int isl94202_activate(const struct device *dev)
 
     // Enable FET control via microcontroller
     reg = ISL94202_CTRL2_UCFET_Msk;
+#ifdef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+    // Balancing FETs are controlled via CBFC register
+    reg |= ISL94202_CTRL2_UCCBAL_Msk;
+#endif
     err = isl94202_write_bytes(dev, ISL94202_CTRL2, &reg, 1);
     if (err) {
         LOG_ERR("Failed to enable MCU FET control: %d", err);
@@ -629,20 +990,59 @@ static int isl94202_activate(const struct device *dev)
 
 static int bms_ic_isl94202_set_mode(const struct device *dev, enum bms_ic_mode mode)
 {
+    struct bms_ic_isl94202_data *dev_data = dev->data;
     uint8_t reg;
+    int err;
+
+    k_mutex_lock(&dev_data->lock, K_FOREVER);
 
     switch (mode) {
         case BMS_IC_MODE_ACTIVE:
-            return isl94202_activate(dev);
+            err = isl94202_activate(dev);
+            break;
         case BMS_IC_MODE_OFF:
             reg = ISL94202_CTRL3_PDWN_Msk;
             isl94202_write_bytes(dev, ISL94202_CTRL3, &reg, 1);
-            return 0;
+            err = 0;
+            break;
         default:
-            return -ENOTSUP;
+            err = -ENOTSUP;
+            break;
     }
+
+    if (err == 0) {
+        dev_data->mode = mode;
+    }
+
+    k_mutex_unlock(&dev_data->lock);
+
+    return err;
 }
 
+static int bms_ic_isl94202_get_status(const struct device *dev, struct bms_ic_status *status)
+{
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+
+    status->mode = dev_data->mode;
+    status->activating = false;
+    status->activation_attempts = 0;
+    status->last_error = 0;
+    status->skipped_transfers = dev_data->skipped_transfers;
+
+    return 0;
+}
+
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+
+static int bms_ic_isl94202_get_snapshot(const struct device *dev, struct bms_ic_snapshot *snapshot)
+{
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+
+    return bms_ic_snapshot_get(&dev_data->snapshot, snapshot);
+}
+
+#endif /* CONFIG_BMS_IC_SNAPSHOT */
+
 static int isl94202_init(const struct device *dev)
 {
     const struct bms_ic_isl94202_config *dev_config = dev->config;
@@ -658,8 +1058,16 @@ static int isl94202_init(const struct device *dev)
     }
 
     dev_data->dev = dev;
+    dev_data->mode = BMS_IC_MODE_OFF;
+    k_mutex_init(&dev_data->lock);
+#ifndef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+    atomic_set(&dev_data->balancing_scan_mode, ISL94202_SCAN_MODE_UNKNOWN);
+#endif
 
     k_work_init_delayable(&dev_data->balancing_work, isl94202_balancing_work_handler);
+#ifdef CONFIG_BMS_IC_ASYNC
+    bms_ic_async_read_init(&dev_data->async_read, dev);
+#endif
 
     return 0;
 }
@@ -668,12 +1076,19 @@ static const struct bms_ic_driver_api isl94202_driver_api = {
     .configure = bms_ic_isl94202_configure,
     .assign_data = bms_ic_isl94202_assign_data,
     .read_data = bms_ic_isl94202_read_data,
+#ifdef CONFIG_BMS_IC_ASYNC
+    .read_data_async = bms_ic_isl94202_read_data_async,
+#endif
 #ifdef CONFIG_BMS_IC_SWITCHES
     .set_switches = bms_ic_isl94202_set_switches,
 #endif
     .balance = bms_ic_isl94202_balance,
     .set_mode = bms_ic_isl94202_set_mode,
     .debug_print_mem = bms_ic_isl94202_debug_print_mem,
+    .get_status = bms_ic_isl94202_get_status,
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+    .get_snapshot = bms_ic_isl94202_get_snapshot,
+#endif
 };
 
 #define ISL94202_ASSERT_CURRENT_MONITORING_PROP_GREATER_ZERO(index, prop) \
@@ -12,15 +12,22 @@
 #include <zephyr/drivers/emul.h>
 #include <zephyr/drivers/i2c.h>
 #include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 
 LOG_MODULE_REGISTER(isl94202_emul, CONFIG_BMS_IC_LOG_LEVEL);
 
+/* internal ADC scans in normal mode (scan duration rounded up from 1.7 ms) */
+#define ISL94202_EMUL_SCAN_PERIOD_MS (32)
+#define ISL94202_EMUL_SCAN_TIME_MS   (2)
+
 struct isl94202_emul_data
 {
     /* Memory of ILS94202 (registers 0x00 to 0xAB) */
     uint8_t mem[0xAB + 1];
     uint32_t cur_reg;
+    /* uptime after which the IC responds via I2C and starts its ADC scans */
+    int64_t wake_up_time;
 };
 
 struct isl94202_emul_cfg
@@ -57,6 +64,14 @@ void isl94202_emul_set_word(const struct emul *em, uint8_t addr, uint16_t word)
     em_data->mem[addr + 1] = word >> 8;
 }
 
+/* no I2C response during the wake-up delay, afterwards scans are indicated via STAT2 INTSCAN */
+void isl94202_emul_wake_up(const struct emul *em, uint32_t delay_ms)
+{
+    struct isl94202_emul_data *em_data = em->data;
+
+    em_data->wake_up_time = k_uptime_get() + delay_ms;
+}
+
 /* fill RAM and flash with suitable values */
 void isl94202_emul_set_mem_defaults(const struct emul *em)
 {
@@ -97,12 +112,20 @@ static int isl94202_emul_read_bytes(const struct emul *em, const uint8_t reg_add
 {
     struct isl94202_emul_data *em_data = em->data;
 
-    if ((reg_addr > 0x58 && reg_addr < 0x7F) || reg_addr + num_bytes > 0xAB || num_bytes > 4) {
+    /* sequential reads are not limited to 4 bytes like writes */
+    if ((reg_addr > 0x58 && reg_addr < 0x7F) || reg_addr + num_bytes > sizeof(em_data->mem)) {
         return -EINVAL;
     }
 
     memcpy(data, em_data->mem + reg_addr, num_bytes);
 
+    if (reg_addr <= ISL94202_STAT2 && reg_addr + num_bytes > ISL94202_STAT2) {
+        int64_t scan_time = (k_uptime_get() - em_data->wake_up_time) % ISL94202_EMUL_SCAN_PERIOD_MS;
+        if (scan_time < ISL94202_EMUL_SCAN_TIME_MS) {
+            data[ISL94202_STAT2 - reg_addr] |= ISL94202_STAT2_INTSCAN_Msk;
+        }
+    }
+
     return 0;
 }
 
@@ -124,22 +147,29 @@ static int isl94202_emul_transfer(const struct emul *em, struct i2c_msg *msgs, i
         return -EIO;
     }
 
+    struct isl94202_emul_data *em_data = em->data;
     uint8_t reg_addr = msgs[0].buf[0];
+    int err;
+
+    if (k_uptime_get() < em_data->wake_up_time) {
+        /* no response before wake-up from shutdown or initial power-up is completed */
+        return -EIO;
+    }
 
     if (msgs[0].flags & I2C_MSG_STOP) {
         /* simple write operation */
-        isl94202_emul_write_bytes(em, reg_addr, msgs[0].buf + 1, msgs[0].len - 1);
+        err = isl94202_emul_write_bytes(em, reg_addr, msgs[0].buf + 1, msgs[0].len - 1);
     }
     else if (num_msgs > 1) {
         /* write-read operation with reg_addr in the first msg */
-        isl94202_emul_read_bytes(em, reg_addr, msgs[1].buf, msgs[1].len);
+        err = isl94202_emul_read_bytes(em, reg_addr, msgs[1].buf, msgs[1].len);
     }
     else {
         LOG_ERR("Unexpected I2C msg. flags: 0x%x, num_msgs: %d", msgs[0].flags, num_msgs);
         return -EIO;
     }
 
-    return 0;
+    return (err == 0) ? 0 : -EIO;
 }
 
 static struct i2c_emul_api bus_api = {
@@ -148,6 +178,9 @@ static struct i2c_emul_api bus_api = {
 
 static int isl94202_emul_init(const struct emul *target, const struct device *parent)
 {
+    /* emulate an IC which already completed its first ADC scan */
+    isl94202_emul_set_mem_defaults(target);
+
     return 0;
 }
 
@@ -23,6 +23,8 @@ void isl94202_emul_set_word(const struct emul *em, uint8_t addr, uint16_t word);
 
 void isl94202_emul_set_mem_defaults(const struct emul *em);
 
+void isl94202_emul_wake_up(const struct emul *em, uint32_t delay_ms);
+
 #ifdef __cplusplus
 }
 #endif
@@ -8,6 +8,7 @@
 #include "isl94202_priv.h"
 #include "isl94202_registers.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include <zephyr/drivers/i2c.h>
@@ -16,14 +17,14 @@
 
 LOG_MODULE_REGISTER(isl94202_if, CONFIG_LOG_DEFAULT_LEVEL);
 
-int isl94202_write_bytes(const struct device *dev, uint8_t reg_addr, uint8_t *data,
-                         uint32_t num_bytes)
+/* write cycle time of the EEPROM */
+#define ISL94202_EEPROM_WRITE_DELAY_MS (30)
+
+static int isl94202_i2c_write(const struct device *dev, uint8_t reg_addr, uint8_t *data,
+                              uint32_t num_bytes)
 {
     const struct bms_ic_isl94202_config *dev_config = dev->config;
-
     uint8_t buf[5];
-    if ((reg_addr > 0x58 && reg_addr < 0x7F) || reg_addr + num_bytes > 0xAB || num_bytes > 4)
-        return -1;
 
     buf[0] = reg_addr; // first byte contains register address
     memcpy(buf + 1, data, num_bytes);
@@ -31,6 +32,92 @@ int isl94202_write_bytes(const struct device *dev, uint8_t reg_addr, uint8_t *da
     return i2c_write_dt(&dev_config->i2c, buf, num_bytes + 1);
 }
 
+void isl94202_config_shadow_invalidate(const struct device *dev)
+{
+#ifdef CONFIG_BMS_IC_ISL94202_CONFIG_SHADOW
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+
+    dev_data->config_shadow_valid = false;
+#endif
+}
+
+#ifdef CONFIG_BMS_IC_ISL94202_CONFIG_SHADOW
+
+static int isl94202_config_shadow_load(const struct device *dev)
+{
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+    int err;
+
+    if (dev_data->config_shadow_valid) {
+        return 0;
+    }
+
+    /* the entire configuration block is fetched with a single transfer */
+    err = isl94202_read_bytes(dev, ISL94202_CONFIG_START, dev_data->config_shadow,
+                              ISL94202_CONFIG_SIZE);
+    dev_data->config_shadow_valid = (err == 0);
+
+    return err;
+}
+
+#endif /* CONFIG_BMS_IC_ISL94202_CONFIG_SHADOW */
+
+/*
+ * The cell configuration must be written twice to be applied reliably (see datasheet 7.1.10).
+ * With the config shadow, the double write is only done for actual changes, as it takes two
+ * EEPROM write cycles.
+ */
+static bool isl94202_double_write_required(uint8_t reg_addr, uint32_t num_bytes)
+{
+    return reg_addr <= ISL94202_MOD_CELL + 1 && reg_addr + num_bytes > ISL94202_MOD_CELL + 1;
+}
+
+static int isl94202_write_config_bytes(const struct device *dev, uint8_t reg_addr, uint8_t *data,
+                                       uint32_t num_bytes)
+{
+#ifdef CONFIG_BMS_IC_ISL94202_CONFIG_SHADOW
+    struct bms_ic_isl94202_data *dev_data = dev->data;
+    uint8_t *shadow = dev_data->config_shadow + reg_addr - ISL94202_CONFIG_START;
+
+    if (isl94202_config_shadow_load(dev) == 0 && memcmp(shadow, data, num_bytes) == 0) {
+        dev_data->skipped_transfers += isl94202_double_write_required(reg_addr, num_bytes) ? 2 : 1;
+        return 0;
+    }
+#endif
+
+    int err = isl94202_i2c_write(dev, reg_addr, data, num_bytes);
+
+    if (err == 0 && isl94202_double_write_required(reg_addr, num_bytes)) {
+        k_sleep(K_MSEC(ISL94202_EEPROM_WRITE_DELAY_MS));
+        err = isl94202_i2c_write(dev, reg_addr, data, num_bytes);
+        k_sleep(K_MSEC(ISL94202_EEPROM_WRITE_DELAY_MS));
+    }
+
+#ifdef CONFIG_BMS_IC_ISL94202_CONFIG_SHADOW
+    if (err == 0 && dev_data->config_shadow_valid) {
+        memcpy(shadow, data, num_bytes);
+    }
+    else {
+        dev_data->config_shadow_valid = false;
+    }
+#endif
+
+    return err;
+}
+
+int isl94202_write_bytes(const struct device *dev, uint8_t reg_addr, uint8_t *data,
+                         uint32_t num_bytes)
+{
+    if ((reg_addr > 0x58 && reg_addr < 0x7F) || reg_addr + num_bytes > 0xAB || num_bytes > 4)
+        return -1;
+
+    if (reg_addr + num_bytes <= ISL94202_CONFIG_START + ISL94202_CONFIG_SIZE) {
+        return isl94202_write_config_bytes(dev, reg_addr, data, num_bytes);
+    }
+
+    return isl94202_i2c_write(dev, reg_addr, data, num_bytes);
+}
+
 int isl94202_read_bytes(const struct device *dev, uint8_t reg_addr, uint8_t *data,
                         uint32_t num_bytes)
 {
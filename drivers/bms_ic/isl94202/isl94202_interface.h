@@ -24,6 +24,8 @@ extern "C" {
 /**
  * Write multiple bytes to ISL94202 IC registers
  *
+ * Writes to the configuration registers are skipped if the values did not change.
+ *
  * @param dev Pointer to the driver device structure instance
  * @param reg_addr The address to write to
  * @param data The pointer to the data buffer
@@ -34,6 +36,16 @@ extern "C" {
 int isl94202_write_bytes(const struct device *dev, uint8_t reg_addr, uint8_t *data,
                          uint32_t num_bytes);
 
+/**
+ * Invalidate the RAM shadow of the ISL94202 configuration registers
+ *
+ * Must be called if the configuration registers may have been changed without the
+ * isl94202_write functions, e.g. after a reset or wake-up of the device.
+ *
+ * @param dev Pointer to the driver device structure instance
+ */
+void isl94202_config_shadow_invalidate(const struct device *dev);
+
 /**
  * Write a word (two bytes) to ISL94202 IC registers
  *
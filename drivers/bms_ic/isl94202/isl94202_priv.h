@@ -12,6 +12,15 @@
  * @brief Private functions and definitions for isl94202 IC driver
  */
 
+#include "bms_ic_charge.h"
+
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+#include "bms_ic_snapshot.h"
+#endif
+#ifdef CONFIG_BMS_IC_ASYNC
+#include "bms_ic_async.h"
+#endif
+
 #include <drivers/bms_ic.h>
 
 #include <stdint.h>
@@ -19,6 +28,14 @@
 #include <zephyr/device.h>
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/drivers/i2c.h>
+#include <zephyr/sys/atomic.h>
+
+/* EEPROM-backed configuration registers */
+#define ISL94202_CONFIG_START (0x00)
+#define ISL94202_CONFIG_SIZE  (0x58 + 1)
+
+/* balancing timing has to be determined by reading STAT3 */
+#define ISL94202_SCAN_MODE_UNKNOWN (0xFF)
 
 /* read-only driver configuration */
 struct bms_ic_isl94202_config
@@ -36,8 +53,55 @@ struct bms_ic_isl94202_data
     struct bms_ic_data *ic_data;
     const struct device *dev;
     struct k_work_delayable balancing_work;
+    /** Serializes API calls, the balancing work and asynchronous reads */
+    struct k_mutex lock;
+    enum bms_ic_mode mode;
     uint8_t fet_state;
     bool auto_balancing;
+#ifndef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+    /**
+     * STAT3 scan mode bits the balancing timing was set for (or ISL94202_SCAN_MODE_UNKNOWN),
+     * shared between read_data and the balancing work
+     */
+    atomic_t balancing_scan_mode;
+    /** Uptime (ms) up to which the operating mode was checked via read_data */
+    int64_t balancing_mode_checked;
+#endif
+    /** Number of bus transfers skipped because the result was already known */
+    uint32_t skipped_transfers;
+#ifdef CONFIG_BMS_IC_SNAPSHOT
+    /** Copies of ic_data published after each read */
+    struct bms_ic_snapshot_buf snapshot;
+#endif
+#ifdef CONFIG_BMS_IC_ASYNC
+    /** Request of bms_ic_read_data_async(), handled in the system work queue */
+    struct bms_ic_async_read async_read;
+#endif
+#ifdef CONFIG_BMS_IC_CURRENT_MONITORING
+    /** Software coulomb counter, updated with every current reading */
+    struct bms_ic_charge_counter charge_counter;
+#endif
+#ifdef CONFIG_BMS_IC_ISL94202_CONFIG_SHADOW
+    /** RAM copy of the configuration registers to skip writes of unchanged values */
+    uint8_t config_shadow[ISL94202_CONFIG_SIZE];
+    bool config_shadow_valid;
+#endif
+#ifdef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+    /** Balancing thresholds cached from struct bms_ic_conf */
+    float bal_cell_voltage_min;
+    float bal_cell_voltage_diff;
+    float bal_idle_current;
+    uint16_t bal_idle_delay;
+    /** Cell temperature range for balancing (charging limits, no balancing before configured) */
+    float bal_temp_min;
+    float bal_temp_max;
+    /** Uptime (ms) of the last current reading above the idle threshold */
+    int64_t active_timestamp;
+    /** Cells currently balanced (same order as cell_voltages in struct bms_ic_data) */
+    uint32_t balancing_status;
+    /** Set if the balancing switches were determined based on the latest cell voltages */
+    bool balancing_plan_valid;
+#endif
 };
 
 #endif /* DRIVERS_BMS_IC_BMS_IC_ISL94202_PRIV_H_ */
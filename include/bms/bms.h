@@ -26,6 +26,10 @@ extern "C" {
 /* fixed number of OCV vs. SOC points */
 #define NUM_OCV_POINTS 21
 
+/* limits for the polling periods of BMS IC data groups (except 0 to disable a group) */
+#define BMS_IC_READ_PERIOD_MIN_MS (50)
+#define BMS_IC_READ_PERIOD_MAX_MS (60000)
+
 /**
  * Possible BMS states
  */
@@ -48,6 +52,19 @@ enum bms_cell_type
     CELL_TYPE_LTO, ///< NMC/Titanate (2.4 V nominal)
 };
 
+/**
+ * Groups of BMS IC data polled with individual periods
+ */
+enum bms_ic_read_group
+{
+    BMS_IC_READ_CURRENT,      ///< BMS_IC_DATA_CURRENT and BMS_IC_DATA_CHARGE
+    BMS_IC_READ_VOLTAGES,     ///< BMS_IC_DATA_CELL_VOLTAGES and BMS_IC_DATA_PACK_VOLTAGES
+    BMS_IC_READ_TEMPERATURES, ///< BMS_IC_DATA_TEMPERATURES
+    BMS_IC_READ_BALANCING,    ///< BMS_IC_DATA_BALANCING
+    BMS_IC_READ_ERROR_FLAGS,  ///< BMS_IC_DATA_ERROR_FLAGS
+    BMS_IC_READ_NUM_GROUPS,
+};
+
 /**
  * Battery Management System context information
  */
@@ -89,6 +106,18 @@ struct bms_context
 
     /** BMS IC data read from the device. */
     struct bms_ic_data ic_data;
+
+    /** Power mode currently requested from the BMS IC */
+    enum bms_ic_mode ic_mode;
+
+    /** Uptime of last current above bal_idle_current (ms) */
+    int64_t active_timestamp;
+
+    /** Periods for polling the BMS IC data groups (ms), 0 to disable polling of a group */
+    uint32_t ic_read_periods[BMS_IC_READ_NUM_GROUPS];
+
+    /** Uptime when the next reading of each BMS IC data group is due (ms) */
+    int64_t ic_read_due[BMS_IC_READ_NUM_GROUPS];
 };
 
 /**
@@ -107,6 +136,70 @@ void bms_init_config(struct bms_context *bms, enum bms_cell_type type, float cap
  */
 void bms_state_machine(struct bms_context *bms);
 
+/**
+ * Select the BMS IC power mode based on the current and the state
+ *
+ * The IC is put into BMS_IC_MODE_IDLE after bal_idle_delay without current above
+ * bal_idle_current. If the MOSFETs were switched off without any pending errors (BMS_STATE_OFF),
+ * BMS_IC_MODE_STANDBY is used instead. The IC is woken up again as soon as current flows or the
+ * state changes and all data is read again before returning.
+ *
+ * Function should be called after each update of the BMS state.
+ *
+ * @param bms Pointer to BMS object.
+ */
+void bms_power_mode_update(struct bms_context *bms);
+
+/**
+ * Determine the BMS IC data to be polled
+ *
+ * All groups with an elapsed period are returned, so that they can be read with a single call
+ * of bms_ic_read_data(). The next due time of the returned groups is advanced by their period.
+ * A shortened period takes effect immediately, i.e. without waiting for the old period.
+ *
+ * @param bms Pointer to BMS object.
+ * @param now Current uptime (ms)
+ *
+ * @returns BMS_IC_DATA_* flags of the groups due for reading (may be 0)
+ */
+uint32_t bms_ic_read_schedule(struct bms_context *bms, int64_t now);
+
+/**
+ * Clamp the polling periods of the BMS IC data groups to sane values
+ *
+ * Must be called after the periods were changed externally (e.g. via ThingSet). Periods of 0
+ * (polling disabled) are kept.
+ *
+ * @param bms Pointer to BMS object.
+ */
+void bms_ic_read_periods_validate(struct bms_context *bms);
+
+/**
+ * Filter the BMS IC data groups signalled by the IC for new data
+ *
+ * Signalled groups are only read if they are due, so that frequent signals (e.g. after each
+ * measurement loop of the IC) don't bypass the period of slow groups. The next due time of the
+ * returned groups starts from now, so they are not polled again in the same period.
+ *
+ * @param bms Pointer to BMS object.
+ * @param flags BMS_IC_DATA_* flags of the data signalled by the IC
+ * @param now Current uptime (ms)
+ *
+ * @returns BMS_IC_DATA_* flags of the signalled groups due for reading (may be 0)
+ */
+uint32_t bms_ic_read_signalled(struct bms_context *bms, uint32_t flags, int64_t now);
+
+/**
+ * Get the time when the next BMS IC data group is due for reading
+ *
+ * @param bms Pointer to BMS object.
+ * @param now Current uptime (ms)
+ *
+ * @returns Uptime of the next due reading (ms), at most CONFIG_BMS_IC_POLLING_INTERVAL_MS after
+ *          now, so that the caller still runs regularly if all groups have long periods.
+ */
+int64_t bms_ic_read_next_due(struct bms_context *bms, int64_t now);
+
 /**
  * Switch off MOSFETs and go into the shutdown state
  *
@@ -115,9 +208,10 @@ void bms_state_machine(struct bms_context *bms);
 void bms_shutdown(struct bms_context *bms);
 
 /**
- * Update SOC based on most recent current measurement
+ * Update SOC based on the charge accumulated by the BMS IC
  *
- * Function should be called each time after a new current measurement was obtained.
+ * Function should be called each time after new data including BMS_IC_DATA_CHARGE was
+ * obtained. The call rate does not affect the accuracy of the coulomb counting.
  *
  * @param bms Pointer to BMS object.
  */
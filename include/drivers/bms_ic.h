@@ -39,7 +39,11 @@ extern "C" {
 #define BMS_IC_DATA_CURRENT       BIT(3)
 #define BMS_IC_DATA_BALANCING     BIT(4)
 #define BMS_IC_DATA_ERROR_FLAGS   BIT(5)
-#define BMS_IC_DATA_ALL           GENMASK(5, 0)
+#define BMS_IC_DATA_CHARGE        BIT(6)
+#define BMS_IC_DATA_ALL           GENMASK(6, 0)
+
+/** Number of BMS_IC_DATA_* groups, i.e. bit positions used by BMS_IC_DATA_ALL */
+#define BMS_IC_DATA_NUM_GROUPS (7)
 
 /**
  * BMS IC operation modes
@@ -155,6 +159,23 @@ struct bms_ic_data
 #ifdef CONFIG_BMS_IC_CURRENT_MONITORING
     /** Module/pack current, charging direction has positive sign (A) */
     float current;
+    /**
+     * Module/pack current averaged by the IC over multiple readings, charging direction has
+     * positive sign (A)
+     *
+     * Equals current if the IC does not provide an averaged value or averaging is not enabled.
+     */
+    float current_avg;
+    /**
+     * Charge passed through the shunt since start of accumulation, charging direction has
+     * positive sign (As)
+     *
+     * Only the difference between two readings is meaningful. Uses the on-chip charge
+     * accumulator if available, otherwise the current is integrated in software.
+     */
+    float charge;
+    /** Time since start of charge accumulation (s) */
+    uint32_t charge_time;
 #endif
 
     /** Cell temperatures (°C) */
@@ -185,6 +206,66 @@ struct bms_ic_data
     uint32_t error_flags;
 };
 
+/**
+ * Operating status of the BMS IC driver
+ */
+struct bms_ic_status
+{
+    /** Last operating mode successfully applied to the IC */
+    enum bms_ic_mode mode;
+    /**
+     * Activation is still in progress (e.g. retrying because the IC does not respond)
+     *
+     * If it is false and last_error is set, the driver gave up and the activation failed.
+     */
+    bool activating;
+    /** Number of failed attempts to communicate with or configure the IC during activation */
+    uint16_t activation_attempts;
+    /** Error code of the last failed activation attempt or 0 */
+    int last_error;
+    /** Number of bus transfers skipped by the driver because the result was already known */
+    uint32_t skipped_transfers;
+};
+
+/**
+ * Consistent copy of the BMS IC data together with the time of the last update of each group
+ */
+struct bms_ic_snapshot
+{
+    /** Copy of the data as published by the driver after its last update */
+    struct bms_ic_data data;
+    /**
+     * Uptime of the last update of each data group (ms) or 0 if never updated
+     *
+     * The index is the bit position of the corresponding BMS_IC_DATA_* flag.
+     */
+    int64_t timestamps[BMS_IC_DATA_NUM_GROUPS];
+    /** Sequence number of the snapshot, incremented with each update published by the driver */
+    uint32_t seq;
+};
+
+/**
+ * Single current measurement with timestamp
+ */
+struct bms_ic_current_sample
+{
+    /** Uptime when the measurement was read from the IC (ms) */
+    int64_t timestamp;
+    /** Module/pack current, charging direction has positive sign (A) */
+    float current;
+};
+
+/**
+ * @brief Callback to notify the application about new data available in the IC.
+ *
+ * The callback should only wake up the application thread, which then reads the data with
+ * bms_ic_read_data().
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param flags BMS_IC_DATA_* flags of the data available for reading.
+ */
+typedef void (*bms_ic_data_callback_t)(const struct device *dev, uint32_t flags);
+
 /**
  * @cond INTERNAL_HIDDEN
  *
@@ -198,6 +279,11 @@ typedef void (*bms_ic_api_assign_data)(const struct device *dev, struct bms_ic_d
 
 typedef int (*bms_ic_api_read_data)(const struct device *dev, uint32_t flags);
 
+#ifdef CONFIG_BMS_IC_ASYNC
+typedef int (*bms_ic_api_read_data_async)(const struct device *dev, uint32_t flags,
+                                          struct k_poll_signal *signal);
+#endif
+
 typedef int (*bms_ic_api_set_switches)(const struct device *dev, uint8_t switches, bool enabled);
 
 typedef int (*bms_ic_api_balance)(const struct device *dev, uint32_t cells);
@@ -212,17 +298,39 @@ typedef int (*bms_ic_api_write_mem)(const struct device *dev, const uint16_t add
 
 typedef int (*bms_ic_api_debug_print_mem)(const struct device *dev);
 
+typedef int (*bms_ic_api_set_data_callback)(const struct device *dev,
+                                            bms_ic_data_callback_t callback);
+
+typedef int (*bms_ic_api_get_status)(const struct device *dev, struct bms_ic_status *status);
+
+typedef int (*bms_ic_api_get_snapshot)(const struct device *dev, struct bms_ic_snapshot *snapshot);
+
+#ifdef CONFIG_BMS_IC_CURRENT_MONITORING
+typedef int (*bms_ic_api_read_current_samples)(const struct device *dev,
+                                               struct bms_ic_current_sample *samples,
+                                               size_t max_samples);
+#endif
+
 __subsystem struct bms_ic_driver_api
 {
     bms_ic_api_configure configure;
     bms_ic_api_assign_data assign_data;
     bms_ic_api_read_data read_data;
+#ifdef CONFIG_BMS_IC_ASYNC
+    bms_ic_api_read_data_async read_data_async;
+#endif
     bms_ic_api_set_switches set_switches;
     bms_ic_api_balance balance;
     bms_ic_api_set_mode set_mode;
     bms_ic_api_read_mem read_mem;
     bms_ic_api_write_mem write_mem;
     bms_ic_api_debug_print_mem debug_print_mem;
+    bms_ic_api_set_data_callback set_data_callback;
+    bms_ic_api_get_status get_status;
+    bms_ic_api_get_snapshot get_snapshot;
+#ifdef CONFIG_BMS_IC_CURRENT_MONITORING
+    bms_ic_api_read_current_samples read_current_samples;
+#endif
 };
 
 /**
@@ -294,6 +402,37 @@ static inline int bms_ic_read_data(const struct device *dev, uint32_t flags)
     return api->read_data(dev, flags);
 }
 
+#ifdef CONFIG_BMS_IC_ASYNC
+/**
+ * @brief Start reading data from the IC without waiting for the result.
+ *
+ * The data is read in the background (e.g. by a work item of the driver) and written to the
+ * bms_ic_data object assigned with @a bms_ic_assign_data. Afterwards, the signal is raised with
+ * the value bms_ic_read_data() would have returned. Values of the assigned object may change
+ * until the signal was raised, so use bms_ic_get_snapshot() to access them in the meantime.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param flags Flags to specify which parts of the data should be updated. See BMS_IC_DATA_*
+ *              defines for valid flags.
+ * @param signal Signal to be raised after completion. Must be initialized by the caller.
+ *
+ * @retval 0 if reading was started
+ * @retval -EBUSY if the previous asynchronous read is still in progress
+ * @retval -ENOSYS if not supported by the driver
+ */
+static inline int bms_ic_read_data_async(const struct device *dev, uint32_t flags,
+                                         struct k_poll_signal *signal)
+{
+    const struct bms_ic_driver_api *api = (const struct bms_ic_driver_api *)dev->api;
+
+    if (api->read_data_async == NULL) {
+        return -ENOSYS;
+    }
+
+    return api->read_data_async(dev, flags, signal);
+}
+#endif /* CONFIG_BMS_IC_ASYNC */
+
 #ifdef CONFIG_BMS_IC_SWITCHES
 /**
  * @brief Switch the specified MOSFET(s) on or off.
@@ -338,10 +477,16 @@ static inline int bms_ic_balance(const struct device *dev, uint32_t cells)
  *
  * Usually used to set the device into different sleep modes for reduced power consumption.
  *
+ * Drivers may complete the activation (BMS_IC_MODE_ACTIVE) asynchronously, e.g. to retry until
+ * the IC responds without blocking the caller. The progress can be obtained via
+ * @a bms_ic_get_status.
+ *
  * @param dev Pointer to the device structure for the driver instance.
  * @param mode Desired BMS IC operating mode.
  *
- * @return 0 for success or negative error code otherwise.
+ * @retval 0 for success
+ * @retval -EINPROGRESS if the mode change is completed asynchronously
+ * @return other negative error code otherwise.
  */
 static inline int bms_ic_set_mode(const struct device *dev, enum bms_ic_mode mode)
 {
@@ -389,6 +534,107 @@ static inline int bms_ic_debug_print_mem(const struct device *dev)
     return api->debug_print_mem(dev);
 }
 
+/**
+ * @brief Register a callback to be notified about new data available in the IC.
+ *
+ * Drivers supporting this feature call the callback as soon as the IC signals new data (e.g. via
+ * an alert pin after a completed measurement or a safety alert), so the application does not
+ * need to poll the IC. The callback is called from the system work queue.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param callback Function to be called if new data is available (NULL to disable).
+ *
+ * @retval 0 for success
+ * @retval -ENOSYS if not supported by the driver
+ * @retval -ENOTSUP if the alert pin of the IC is not configured or its interrupt not available
+ * @retval -EIO for communication error
+ */
+static inline int bms_ic_set_data_callback(const struct device *dev,
+                                           bms_ic_data_callback_t callback)
+{
+    const struct bms_ic_driver_api *api = (const struct bms_ic_driver_api *)dev->api;
+
+    if (api->set_data_callback == NULL) {
+        return -ENOSYS;
+    }
+
+    return api->set_data_callback(dev, callback);
+}
+
+/**
+ * @brief Get the operating status of the BMS IC driver.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param status Pointer to the status object to be filled.
+ *
+ * @retval 0 for success
+ * @retval -ENOSYS if not supported by the driver
+ */
+static inline int bms_ic_get_status(const struct device *dev, struct bms_ic_status *status)
+{
+    const struct bms_ic_driver_api *api = (const struct bms_ic_driver_api *)dev->api;
+
+    if (api->get_status == NULL) {
+        return -ENOSYS;
+    }
+
+    return api->get_status(dev, status);
+}
+
+/**
+ * @brief Get a consistent copy of the data most recently read by the driver.
+ *
+ * In contrast to the bms_ic_data object assigned with bms_ic_assign_data(), all values of the
+ * copy belong to the same update, even if the driver writes new data concurrently (e.g. from a
+ * work item). The function does not take any locks, so it can be used by other threads without
+ * delaying the driver.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param snapshot Pointer to store the copy.
+ *
+ * @retval 0 for success
+ * @retval -ENODATA if no data was read so far
+ * @retval -ENOSYS if not supported by the driver
+ */
+static inline int bms_ic_get_snapshot(const struct device *dev, struct bms_ic_snapshot *snapshot)
+{
+    const struct bms_ic_driver_api *api = (const struct bms_ic_driver_api *)dev->api;
+
+    if (api->get_snapshot == NULL) {
+        return -ENOSYS;
+    }
+
+    return api->get_snapshot(dev, snapshot);
+}
+
+#ifdef CONFIG_BMS_IC_CURRENT_MONITORING
+/**
+ * @brief Read and remove buffered current samples.
+ *
+ * Drivers supporting this function store every new current measurement of the IC, even if
+ * bms_ic_read_data() is called less frequently. Only one thread may consume the samples.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param samples Array to store the samples, oldest sample first.
+ * @param max_samples Maximum number of samples to be stored in the array.
+ *
+ * @returns Number of samples stored in the array or negative error code
+ * @retval -ENOSYS if not supported by the driver
+ */
+static inline int bms_ic_read_current_samples(const struct device *dev,
+                                              struct bms_ic_current_sample *samples,
+                                              size_t max_samples)
+{
+    const struct bms_ic_driver_api *api = (const struct bms_ic_driver_api *)dev->api;
+
+    if (api->read_current_samples == NULL) {
+        return -ENOSYS;
+    }
+
+    return api->read_current_samples(dev, samples, max_samples);
+}
+#endif /* CONFIG_BMS_IC_CURRENT_MONITORING */
+
 #ifdef __cplusplus
 }
 #endif
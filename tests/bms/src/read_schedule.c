@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#include <bms/bms.h>
+
+#include <string.h>
+
+extern struct bms_context bms;
+
+static const uint32_t current_flags =
+    IS_ENABLED(CONFIG_BMS_IC_CURRENT_MONITORING) ? BMS_IC_DATA_CURRENT | BMS_IC_DATA_CHARGE : 0;
+
+static void init_periods()
+{
+    memset(bms.ic_read_due, 0, sizeof(bms.ic_read_due));
+
+    bms.ic_read_periods[BMS_IC_READ_CURRENT] = 50;
+    bms.ic_read_periods[BMS_IC_READ_VOLTAGES] = 250;
+    bms.ic_read_periods[BMS_IC_READ_TEMPERATURES] = 2000;
+    bms.ic_read_periods[BMS_IC_READ_BALANCING] = 0;
+    bms.ic_read_periods[BMS_IC_READ_ERROR_FLAGS] = 250;
+}
+
+ZTEST(read_schedule, test_all_enabled_groups_due_initially)
+{
+    init_periods();
+
+    uint32_t flags = bms_ic_read_schedule(&bms, 1000);
+
+    zassert_equal(current_flags | BMS_IC_DATA_CELL_VOLTAGES | BMS_IC_DATA_PACK_VOLTAGES
+                      | BMS_IC_DATA_TEMPERATURES | BMS_IC_DATA_ERROR_FLAGS,
+                  flags);
+
+    /* nothing due again before the shortest period elapsed */
+    zassert_equal(0, bms_ic_read_schedule(&bms, 1049));
+}
+
+ZTEST(read_schedule, test_groups_read_with_individual_periods)
+{
+    int cnt_current = 0;
+    int cnt_voltages = 0;
+    int cnt_temps = 0;
+
+    init_periods();
+
+    for (int64_t now = 0; now < 2000; now += 10) {
+        uint32_t flags = bms_ic_read_schedule(&bms, now);
+        cnt_current += (flags & BMS_IC_DATA_CURRENT) ? 1 : 0;
+        cnt_voltages += (flags & BMS_IC_DATA_CELL_VOLTAGES) ? 1 : 0;
+        cnt_temps += (flags & BMS_IC_DATA_TEMPERATURES) ? 1 : 0;
+        zassert_equal(0, flags & BMS_IC_DATA_BALANCING);
+    }
+
+    zassert_equal(IS_ENABLED(CONFIG_BMS_IC_CURRENT_MONITORING) ? 40 : 0, cnt_current);
+    zassert_equal(8, cnt_voltages);
+    zassert_equal(1, cnt_temps);
+}
+
+ZTEST(read_schedule, test_next_due)
+{
+    init_periods();
+
+    bms_ic_read_schedule(&bms, 1000);
+    zassert_equal(1050, bms_ic_read_next_due(&bms, 1000));
+
+    /* missed readings are not caught up */
+    bms_ic_read_schedule(&bms, 1500);
+    zassert_equal(1550, bms_ic_read_next_due(&bms, 1500));
+
+    /* wake up regularly even if all groups are disabled */
+    memset(bms.ic_read_periods, 0, sizeof(bms.ic_read_periods));
+    zassert_equal(1500 + CONFIG_BMS_IC_POLLING_INTERVAL_MS, bms_ic_read_next_due(&bms, 1500));
+}
+
+ZTEST(read_schedule, test_signalled_data_read_when_due)
+{
+    const uint32_t voltages = BMS_IC_DATA_CELL_VOLTAGES | BMS_IC_DATA_PACK_VOLTAGES;
+
+    init_periods();
+
+    bms_ic_read_schedule(&bms, 1000);
+
+    /* voltages signalled by the IC before they are due */
+    zassert_equal(0, bms_ic_read_signalled(&bms, voltages, 1200));
+
+    /* signalled voltages read shortly after they became due */
+    zassert_equal(voltages, bms_ic_read_signalled(&bms, voltages, 1260));
+
+    /* not polled again within the same period */
+    uint32_t flags = bms_ic_read_schedule(&bms, 1500);
+    zassert_equal(0, flags & voltages);
+    zassert_equal(BMS_IC_DATA_ERROR_FLAGS, flags & BMS_IC_DATA_ERROR_FLAGS);
+
+    flags = bms_ic_read_schedule(&bms, 1510);
+    zassert_equal(voltages, flags & voltages);
+}
+
+ZTEST(read_schedule, test_alert_while_temperatures_not_due)
+{
+    init_periods();
+
+    bms_ic_read_schedule(&bms, 1000);
+
+    /* e.g. bq769x2 FULLSCAN alert after each measurement loop signals all data */
+    zassert_equal(current_flags, bms_ic_read_signalled(&bms, BMS_IC_DATA_ALL, 1100));
+    zassert_equal(0, bms_ic_read_schedule(&bms, 1100));
+
+    zassert_equal(current_flags | BMS_IC_DATA_CELL_VOLTAGES | BMS_IC_DATA_PACK_VOLTAGES
+                      | BMS_IC_DATA_ERROR_FLAGS,
+                  bms_ic_read_signalled(&bms, BMS_IC_DATA_ALL, 1250));
+
+    /* temperatures only read after their period elapsed, balancing not at all (disabled) */
+    uint32_t flags = bms_ic_read_signalled(&bms, BMS_IC_DATA_ALL, 2000);
+    zassert_equal(BMS_IC_DATA_TEMPERATURES, flags & BMS_IC_DATA_TEMPERATURES);
+    zassert_equal(0, flags & BMS_IC_DATA_BALANCING);
+}
+
+ZTEST(read_schedule, test_shortened_period_applied_immediately)
+{
+    init_periods();
+
+    bms_ic_read_schedule(&bms, 1000);
+    zassert_equal(2000, bms.ic_read_due[BMS_IC_READ_TEMPERATURES]);
+
+    /* e.g. changed via ThingSet */
+    bms.ic_read_periods[BMS_IC_READ_TEMPERATURES] = 100;
+    zassert_equal(1050, bms_ic_read_next_due(&bms, 1000));
+    zassert_equal(0, bms_ic_read_schedule(&bms, 1000) & BMS_IC_DATA_TEMPERATURES);
+    zassert_equal(BMS_IC_DATA_TEMPERATURES,
+                  bms_ic_read_schedule(&bms, 1100) & BMS_IC_DATA_TEMPERATURES);
+    zassert_equal(1200, bms.ic_read_due[BMS_IC_READ_TEMPERATURES]);
+}
+
+ZTEST(read_schedule, test_periods_clamped)
+{
+    init_periods();
+
+    bms.ic_read_periods[BMS_IC_READ_CURRENT] = 1;
+    bms.ic_read_periods[BMS_IC_READ_TEMPERATURES] = UINT32_MAX;
+    bms_ic_read_periods_validate(&bms);
+
+    zassert_equal(BMS_IC_READ_PERIOD_MIN_MS, bms.ic_read_periods[BMS_IC_READ_CURRENT]);
+    zassert_equal(BMS_IC_READ_PERIOD_MAX_MS, bms.ic_read_periods[BMS_IC_READ_TEMPERATURES]);
+
+    /* disabled groups stay disabled */
+    zassert_equal(0, bms.ic_read_periods[BMS_IC_READ_BALANCING]);
+}
+
+ZTEST_SUITE(read_schedule, NULL, NULL, NULL, NULL, NULL);
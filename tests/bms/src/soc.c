@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#include <bms/bms.h>
+
+extern struct bms_context bms;
+
+static void charge_update(float charge, uint32_t charge_time)
+{
+    bms.ic_data.charge = charge;
+    bms.ic_data.charge_time = charge_time;
+    bms_soc_update(&bms);
+}
+
+ZTEST(soc, test_soc_charge_counter_resync)
+{
+    bms.nominal_capacity_Ah = 1.0F;
+    bms.ic_conf.dis_sc_limit = 100.0F;
+
+    /* establish the reference */
+    charge_update(100.0F, 100);
+    charge_update(100.0F, 101);
+    bms.soc = 50.0F;
+
+    /* 36 As = 1% of 1 Ah */
+    charge_update(136.0F, 110);
+    zassert_within(51.0F, bms.soc, 0.01F);
+
+    /* accumulation restarted after IC reset */
+    charge_update(0.0F, 0);
+    zassert_within(51.0F, bms.soc, 0.01F);
+
+    charge_update(-36.0F, 10);
+    zassert_within(50.0F, bms.soc, 0.01F);
+
+    /* counter wrap-around */
+    charge_update(1e6F, 11);
+    zassert_within(50.0F, bms.soc, 0.01F);
+
+    charge_update(1e6F + 36.0F, 12);
+    zassert_within(51.0F, bms.soc, 0.01F);
+}
+
+ZTEST_SUITE(soc, NULL, NULL, NULL, NULL, NULL);
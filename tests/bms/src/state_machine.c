@@ -231,4 +231,42 @@ ZTEST(state_machine, test_balancing2normal_if_done)
 }
 */
 
+ZTEST(state_machine, test_ic_idle_mode_after_idle_delay)
+{
+    init_conf();
+    bms.state = BMS_STATE_NORMAL;
+    bms.ic_conf.bal_idle_delay = 0;
+    bms.ic_conf.bal_idle_current = 0.1;
+    bms.ic_data.current = 0;
+    bms.active_timestamp = k_uptime_get() - 1;
+    bms_power_mode_update(&bms);
+    zassert_equal(BMS_IC_MODE_IDLE, bms.ic_mode);
+
+    bms.ic_data.current = 1.0;
+    bms_power_mode_update(&bms);
+    zassert_equal(BMS_IC_MODE_ACTIVE, bms.ic_mode);
+}
+
+ZTEST(state_machine, test_no_ic_standby_if_off_with_errors)
+{
+    init_conf();
+    bms.state = BMS_STATE_OFF;
+    bms.ic_conf.bal_idle_delay = 0;
+    bms.ic_conf.bal_idle_current = 0.1;
+    bms.ic_data.current = 0;
+    bms.ic_data.balancing_status = 0;
+    bms.ic_data.error_flags = BMS_ERR_CELL_UNDERVOLTAGE;
+    bms.active_timestamp = k_uptime_get() - 1;
+    bms_power_mode_update(&bms);
+    zassert_equal(BMS_IC_MODE_IDLE, bms.ic_mode);
+
+    bms.ic_data.error_flags = 0;
+    bms_power_mode_update(&bms);
+    zassert_equal(BMS_IC_MODE_STANDBY, bms.ic_mode);
+
+    bms.ic_data.current = 1.0;
+    bms_power_mode_update(&bms);
+    zassert_equal(BMS_IC_MODE_ACTIVE, bms.ic_mode);
+}
+
 ZTEST_SUITE(state_machine, NULL, NULL, NULL, NULL, NULL);
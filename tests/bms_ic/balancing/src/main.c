@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "bms_ic_balancing.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define NUM_RANDOM_RUNS (200)
+
+/* simple deterministic pseudo-random numbers, so that failures are reproducible */
+static uint32_t lcg_next(void)
+{
+    static uint32_t state = 12345;
+
+    state = state * 1103515245U + 12345U;
+
+    return state >> 16;
+}
+
+static float excess_sum(const float *cell_voltages, uint32_t cells, float threshold)
+{
+    float sum = 0.0F;
+
+    for (int i = 0; i < 32; i++) {
+        if (cells & BIT(i)) {
+            sum += cell_voltages[i] - threshold;
+        }
+    }
+
+    return sum;
+}
+
+/* exhaustive search over all subsets of non-adjacent cells above the threshold */
+static float brute_force_best(const float *cell_voltages, size_t num_cells, float threshold)
+{
+    float best = 0.0F;
+
+    for (uint32_t cells = 0; cells < BIT(num_cells); cells++) {
+        bool valid = (cells & (cells << 1)) == 0;
+
+        for (int i = 0; i < num_cells && valid; i++) {
+            if ((cells & BIT(i)) && cell_voltages[i] <= threshold) {
+                valid = false;
+            }
+        }
+
+        if (valid) {
+            best = MAX(best, excess_sum(cell_voltages, cells, threshold));
+        }
+    }
+
+    return best;
+}
+
+ZTEST(bms_ic_balancing, test_no_candidates)
+{
+    const float cell_voltages[5] = { 3.30F, 3.31F, 3.30F, 3.32F, 3.30F };
+
+    zassert_equal(0, bms_ic_balancing_plan(cell_voltages, 5, 3.35F));
+}
+
+ZTEST(bms_ic_balancing, test_non_adjacent)
+{
+    /* all cells above threshold: every second cell starting with the first one */
+    const float cell_voltages[5] = { 3.40F, 3.40F, 3.40F, 3.40F, 3.40F };
+
+    zassert_equal(0x15, bms_ic_balancing_plan(cell_voltages, 5, 3.35F));
+}
+
+ZTEST(bms_ic_balancing, test_better_than_greedy)
+{
+    /*
+     * Greedy selection of the highest cell first would only balance cell 2, whereas balancing
+     * cells 1 and 3 removes more excess voltage.
+     */
+    const float cell_voltages[5] = { 3.30F, 3.45F, 3.50F, 3.45F, 3.30F };
+
+    zassert_equal(0x0A, bms_ic_balancing_plan(cell_voltages, 5, 3.35F));
+}
+
+ZTEST(bms_ic_balancing, test_random_vs_brute_force)
+{
+    float cell_voltages[16];
+    float threshold = 3.35F;
+
+    for (int run = 0; run < NUM_RANDOM_RUNS; run++) {
+        size_t num_cells = 1 + lcg_next() % ARRAY_SIZE(cell_voltages);
+
+        for (int i = 0; i < num_cells; i++) {
+            cell_voltages[i] = 3.30F + (lcg_next() % 200) * 0.001F;
+        }
+
+        uint32_t cells = bms_ic_balancing_plan(cell_voltages, num_cells, threshold);
+
+        zassert_equal(0, cells & (cells << 1), "adjacent cells selected: 0x%X", cells);
+        zassert_equal(0, cells & ~(BIT(num_cells) - 1), "invalid cells selected: 0x%X", cells);
+        zassert_within(brute_force_best(cell_voltages, num_cells, threshold),
+                       excess_sum(cell_voltages, cells, threshold), 1e-5F);
+    }
+}
+
+ZTEST_SUITE(bms_ic_balancing, NULL, NULL, NULL, NULL, NULL);
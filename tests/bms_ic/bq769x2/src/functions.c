@@ -6,9 +6,12 @@
 
 #include <bms/bms.h>
 #include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/ztest.h>
 
 #include "bq769x2_emul.h"
+#include "bq769x2_interface.h"
 
 #include "bms_setup.h"
 
@@ -505,6 +508,371 @@ ZTEST(bq769x2_functions, test_apply_temp_limits)
                   bq769x2_emul_get_data_mem(bms_ic_emul, 0x9262));
 }
 
+ZTEST(bq769x2_functions, test_configure_unchanged)
+{
+    int err;
+
+    bms.ic_conf.chg_oc_limit = 10 * 2.0F / shunt_res_mohm;
+    err = bms_ic_configure(bms.ic_dev, &bms.ic_conf, BMS_IC_CONF_CURRENT_LIMITS);
+    zassert_equal(BMS_IC_CONF_CURRENT_LIMITS, err);
+    zassert_equal(10, bq769x2_emul_get_data_mem(bms_ic_emul, 0x9280));
+
+    // overwrite subcommand register to detect any further subcommand or data memory access
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x3E, 0x00);
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x3F, 0x00);
+
+    // same values again: no access to data memory and no config update mode
+    err = bms_ic_configure(bms.ic_dev, &bms.ic_conf, BMS_IC_CONF_CURRENT_LIMITS);
+    zassert_equal(BMS_IC_CONF_CURRENT_LIMITS, err);
+    zassert_equal(0x00, bq769x2_emul_get_direct_mem(bms_ic_emul, 0x3E));
+    zassert_equal(0x00, bq769x2_emul_get_direct_mem(bms_ic_emul, 0x3F));
+
+    // changed value: written to the device and config update mode exited afterwards
+    bms.ic_conf.chg_oc_limit = 12 * 2.0F / shunt_res_mohm;
+    err = bms_ic_configure(bms.ic_dev, &bms.ic_conf, BMS_IC_CONF_CURRENT_LIMITS);
+    zassert_equal(BMS_IC_CONF_CURRENT_LIMITS, err);
+    zassert_equal(12, bq769x2_emul_get_data_mem(bms_ic_emul, 0x9280));
+    zassert_equal(0x00, bq769x2_emul_get_direct_mem(bms_ic_emul, 0x12) & 0x01);
+}
+
+ZTEST(bq769x2_functions, test_configure_block_write)
+{
+    int err;
+
+    bms.ic_conf.dis_ot_limit = 50;
+    bms.ic_conf.dis_ut_limit = -10;
+    bms.ic_conf.chg_ot_limit = 45;
+    bms.ic_conf.chg_ut_limit = 5;
+    bms.ic_conf.temp_limit_hyst = 3;
+
+    err = bms_ic_configure(bms.ic_dev, &bms.ic_conf, BMS_IC_CONF_TEMP_LIMITS);
+    zassert_equal(BMS_IC_CONF_TEMP_LIMITS, err);
+
+    // OTC threshold (0x929A) to UTD recovery (0x92AB) written in a single transfer of 18 bytes
+    zassert_equal(4 + 18, bq769x2_emul_get_direct_mem(bms_ic_emul, 0x61));
+    zassert_equal(45, (int8_t)bq769x2_emul_get_data_mem(bms_ic_emul, 0x929A));
+    zassert_equal(47, (int8_t)bq769x2_emul_get_data_mem(bms_ic_emul, 0x929F));
+    zassert_equal(5, (int8_t)bq769x2_emul_get_data_mem(bms_ic_emul, 0x92A6));
+    zassert_equal(-7, (int8_t)bq769x2_emul_get_data_mem(bms_ic_emul, 0x92AB));
+}
+
+ZTEST(bq769x2_functions, test_read_cell_voltages)
+{
+    int err;
+
+    /* cell voltages 3.300 V ... 3.315 V in registers 0x14 to 0x33 (little-endian, unit: mV) */
+    for (int i = 0; i < 16; i++) {
+        uint16_t voltage = 3300 + i;
+        bq769x2_emul_set_direct_mem(bms_ic_emul, 0x14 + i * 2, voltage & 0xFF);
+        bq769x2_emul_set_direct_mem(bms_ic_emul, 0x14 + i * 2 + 1, voltage >> 8);
+    }
+
+    err = bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_CELL_VOLTAGES);
+    zassert_equal(0, err);
+
+    for (int i = 0; i < 16; i++) {
+        zassert_equal(3300 + i, lroundf(bms.ic_data.cell_voltages[i] * 1000));
+    }
+    zassert_equal(16, bms.ic_data.connected_cells);
+    zassert_equal(3300, lroundf(bms.ic_data.cell_voltage_min * 1000));
+    zassert_equal(3315, lroundf(bms.ic_data.cell_voltage_max * 1000));
+    zassert_equal(33075, lroundf(bms.ic_data.cell_voltage_avg * 10000));
+}
+
+ZTEST(bq769x2_functions, test_read_cell_snapshot)
+{
+    uint8_t dastatus[32];
+    int err;
+
+    if (!IS_ENABLED(CONFIG_BMS_IC_BQ769X2_SYNC_SNAPSHOT)) {
+        ztest_test_skip();
+    }
+
+    /* cell gain 12000 and zero offset, so 2^24 / 12000 counts per mV */
+    for (int i = 0; i < 16; i++) {
+        bq769x2_emul_set_data_mem(bms_ic_emul, 0x9180 + i * 2, 12000 & 0xFF);
+        bq769x2_emul_set_data_mem(bms_ic_emul, 0x9180 + i * 2 + 1, 12000 >> 8);
+    }
+    bq769x2_emul_set_data_mem(bms_ic_emul, 0x91B0, 0);
+    bq769x2_emul_set_data_mem(bms_ic_emul, 0x91B1, 0);
+    bq769x2_datamem_cache_invalidate(bms.ic_dev);
+
+    /* DASTATUS1 to DASTATUS4 (0x0071..0x0074): voltage and current counts of 4 cells each */
+    for (int block = 0; block < 4; block++) {
+        for (int j = 0; j < 4; j++) {
+            int32_t voltage_counts = ((3300 + block * 4 + j) * 16777216LL + 11999) / 12000;
+            int32_t current_counts = 100;
+            sys_put_le32(voltage_counts, &dastatus[j * 8]);
+            sys_put_le32(current_counts, &dastatus[j * 8 + 4]);
+        }
+        bq769x2_emul_set_dastatus(bms_ic_emul, 0x0071 + block, dastatus, sizeof(dastatus));
+    }
+
+    err = bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_CELL_VOLTAGES | BMS_IC_DATA_CURRENT);
+    zassert_equal(0, err);
+
+    for (int i = 0; i < 16; i++) {
+        zassert_equal(3300 + i, lroundf(bms.ic_data.cell_voltages[i] * 1000));
+    }
+    zassert_equal(3300, lroundf(bms.ic_data.cell_voltage_min * 1000));
+    zassert_equal(3315, lroundf(bms.ic_data.cell_voltage_max * 1000));
+
+    /* CC gain configured by the driver based on the shunt resistor (mA per count) */
+    zassert_within(100 * 7.5684F / shunt_res_mohm * 1e-3F, bms.ic_data.current, 0.01F);
+}
+
+ZTEST(bq769x2_functions, test_read_temperatures)
+{
+    int err;
+
+    /* TS1 (cell temperature) in 0x70, DCHG (MOSFET temperature) in 0x78, unit: 0.1 K */
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x70, 2982 & 0xFF);
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x71, 2982 >> 8);
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x78, 3032 & 0xFF);
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x79, 3032 >> 8);
+
+    /* internal temperature in 0x68 */
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x68, 3132 & 0xFF);
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x69, 3132 >> 8);
+
+    err = bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_TEMPERATURES);
+    zassert_equal(0, err);
+
+    zassert_equal(1, bms.ic_data.used_thermistors);
+    zassert_within(25.05F, bms.ic_data.cell_temps[0], 0.01F);
+    zassert_within(25.05F, bms.ic_data.cell_temp_avg, 0.01F);
+    zassert_within(30.05F, bms.ic_data.mosfet_temp, 0.01F);
+    zassert_within(40.05F, bms.ic_data.ic_temp, 0.01F);
+}
+
+ZTEST(bq769x2_functions, test_read_error_flags)
+{
+    int err;
+
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x03, 1U << 3); /* COV */
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x05, 1U << 4); /* OTC */
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x07, 0);
+
+    err = bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_ERROR_FLAGS);
+    zassert_equal(0, err);
+    zassert_equal(BMS_ERR_CELL_OVERVOLTAGE | BMS_ERR_CHG_OVERTEMP, bms.ic_data.error_flags);
+
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x03, 0);
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x05, 0);
+
+    err = bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_ERROR_FLAGS);
+    zassert_equal(0, err);
+    zassert_equal(0, bms.ic_data.error_flags);
+}
+
+ZTEST(bq769x2_functions, test_read_charge)
+{
+    /*
+     * DASTATUS6 subcommand 0x0076: accumulated charge 100.5 userAh (integer part and fraction
+     * of 2^32) and accumulation time 3600 s, little-endian
+     */
+    const uint8_t dastatus6[12] = {
+        0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x0E, 0x00, 0x00,
+    };
+    int err;
+
+    bq769x2_emul_set_dastatus(bms_ic_emul, 0x0076, dastatus6, sizeof(dastatus6));
+
+    err = bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_CHARGE);
+    zassert_equal(0, err);
+
+    /* userAh configured as 10 mAh = 36 As */
+    zassert_within(3618.0F, bms.ic_data.charge, 0.01F);
+    zassert_equal(3600, bms.ic_data.charge_time);
+}
+
+ZTEST(bq769x2_functions, test_read_current_avg)
+{
+    /* DASTATUS5 subcommand 0x0075: CC3 current at offset 20 (-1.23 A in 10 mA userA) */
+    uint8_t dastatus5[32] = { 0 };
+    int err;
+
+    /* CC3 Samples setting from Devicetree applied during activation */
+    zassert_equal(80, bq769x2_emul_get_data_mem(bms_ic_emul, 0x9307));
+
+    sys_put_le16((uint16_t)-123, &dastatus5[20]);
+    bq769x2_emul_set_dastatus(bms_ic_emul, 0x0075, dastatus5, sizeof(dastatus5));
+
+    /* instantaneous CC2 current 2.50 A */
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x3A, 250 & 0xFF);
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x3B, 250 >> 8);
+
+    err = bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_CURRENT);
+    zassert_equal(0, err);
+
+    zassert_within(2.50F, bms.ic_data.current, 0.001F);
+    zassert_within(-1.23F, bms.ic_data.current_avg, 0.001F);
+}
+
+ZTEST(bq769x2_functions, test_read_data_async)
+{
+    struct k_poll_signal signal;
+    struct k_poll_event event =
+        K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &signal);
+    unsigned int signaled;
+    int result;
+    int err;
+
+    /* instantaneous CC2 current 1.00 A */
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x3A, 100 & 0xFF);
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x3B, 100 >> 8);
+    bms.ic_data.current = 0.0F;
+    k_poll_signal_init(&signal);
+
+    err = bms_ic_read_data_async(bms.ic_dev, BMS_IC_DATA_CURRENT, &signal);
+    zassert_equal(0, err);
+
+    /* synchronous access from this thread is serialized with the request by the driver */
+    err = bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_ERROR_FLAGS);
+    zassert_equal(0, err);
+
+    err = k_poll(&event, 1, K_MSEC(100));
+    zassert_equal(0, err);
+    k_poll_signal_check(&signal, &signaled, &result);
+    zassert_true(signaled);
+    zassert_equal(0, result);
+    zassert_within(1.00F, bms.ic_data.current, 0.001F);
+}
+
+ZTEST(bq769x2_functions, test_configure_status_read_error)
+{
+    struct k_poll_signal signal;
+    struct k_poll_event event =
+        K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &signal);
+    int err;
+
+    bms.ic_conf.dis_sc_limit = 10.0F / shunt_res_mohm; // reg value 0 = 10 mV
+    bms.ic_conf.dis_sc_delay_us = (2 - 1) * 15;        // reg value 2
+    err = bms_ic_configure(bms.ic_dev, &bms.ic_conf, BMS_IC_CONF_CURRENT_LIMITS);
+    zassert_equal(BMS_IC_CONF_CURRENT_LIMITS, err);
+
+    /* BATTERY_STATUS is read before the first data memory write */
+    bq769x2_emul_set_read_error(bms_ic_emul, 0x12);
+
+    bms.ic_conf.dis_sc_delay_us = (3 - 1) * 15; // reg value 3
+    err = bms_ic_configure(bms.ic_dev, &bms.ic_conf, BMS_IC_CONF_CURRENT_LIMITS);
+    zassert_equal(-EIO, err);
+
+    bq769x2_emul_set_read_error(bms_ic_emul, -1);
+
+    /* nothing written without config update mode */
+    zassert_equal(2, bq769x2_emul_get_data_mem(bms_ic_emul, 0x9287));
+    zassert_equal(0, bq769x2_emul_get_direct_mem(bms_ic_emul, 0x12) & (1U << 0)); // CFGUPDATE
+
+    /* the device is not left locked for other threads (async read runs in the work queue) */
+    k_poll_signal_init(&signal);
+    err = bms_ic_read_data_async(bms.ic_dev, BMS_IC_DATA_CURRENT, &signal);
+    zassert_equal(0, err);
+    err = k_poll(&event, 1, K_MSEC(100));
+    zassert_equal(0, err);
+
+    err = bms_ic_configure(bms.ic_dev, &bms.ic_conf, BMS_IC_CONF_CURRENT_LIMITS);
+    zassert_equal(BMS_IC_CONF_CURRENT_LIMITS, err);
+    zassert_equal(3, bq769x2_emul_get_data_mem(bms_ic_emul, 0x9287));
+}
+
+ZTEST(bq769x2_functions, test_activation_status)
+{
+    struct bms_ic_status status;
+    int err;
+
+    /* activation is completed asynchronously by the driver */
+    err = bms_ic_set_mode(bms.ic_dev, BMS_IC_MODE_ACTIVE);
+    zassert_equal(-EINPROGRESS, err);
+
+    err = bms_ic_get_status(bms.ic_dev, &status);
+    zassert_equal(0, err);
+    zassert_true(status.activating);
+
+    for (int i = 0; i < 100 && status.activating; i++) {
+        k_sleep(K_MSEC(10));
+        bms_ic_get_status(bms.ic_dev, &status);
+    }
+
+    zassert_false(status.activating);
+    zassert_equal(BMS_IC_MODE_ACTIVE, status.mode);
+    zassert_equal(0, status.activation_attempts);
+    zassert_equal(0, status.last_error);
+
+    /* configuration is accepted again after completed activation */
+    err = bms_ic_configure(bms.ic_dev, &bms.ic_conf, BMS_IC_CONF_ALL);
+    zassert_true(err > 0);
+}
+
+ZTEST(bq769x2_functions, test_activation_failure)
+{
+    struct bms_ic_status status;
+    int err;
+
+    /* IC does not respond at all */
+    bq769x2_emul_set_bus_error(bms_ic_emul, true);
+
+    err = bms_ic_set_mode(bms.ic_dev, BMS_IC_MODE_ACTIVE);
+    zassert_equal(-EINPROGRESS, err);
+
+    /* retries with exponential backoff need approx. 10 s for the default number of attempts */
+    bms_ic_get_status(bms.ic_dev, &status);
+    for (int i = 0; i < 3000 && status.activating; i++) {
+        k_sleep(K_MSEC(10));
+        bms_ic_get_status(bms.ic_dev, &status);
+    }
+
+    bq769x2_emul_set_bus_error(bms_ic_emul, false);
+
+    zassert_false(status.activating);
+    zassert_equal(CONFIG_BMS_IC_BQ769X2_ACTIVATION_ATTEMPTS, status.activation_attempts);
+    zassert_not_equal(0, status.last_error);
+
+    /* activation succeeds again after the IC is back */
+    err = bms_ic_set_mode(bms.ic_dev, BMS_IC_MODE_ACTIVE);
+    zassert_equal(-EINPROGRESS, err);
+
+    bms_ic_get_status(bms.ic_dev, &status);
+    for (int i = 0; i < 100 && status.activating; i++) {
+        k_sleep(K_MSEC(10));
+        bms_ic_get_status(bms.ic_dev, &status);
+    }
+
+    zassert_false(status.activating);
+    zassert_equal(0, status.last_error);
+}
+
+ZTEST(bq769x2_functions, test_startup_time)
+{
+    int64_t startup_ms = common_startup_time_ms();
+
+    TC_PRINT("BQ769x2 time to first valid data: %lld ms\n", (long long)startup_ms);
+
+    zassert_true(startup_ms >= 0);
+    zassert_true(startup_ms < 1000);
+}
+
+ZTEST(bq769x2_functions, test_set_mode_low_power)
+{
+    int err;
+
+    /* IDLE: SLEEP_EN in battery status (0x12) set via SLEEP_ENABLE subcommand */
+    err = bms_ic_set_mode(bms.ic_dev, BMS_IC_MODE_IDLE);
+    zassert_equal(0, err);
+    zassert_equal(0x04, bq769x2_emul_get_direct_mem(bms_ic_emul, 0x12) & 0x04);
+
+    /* STANDBY: DEEPSLEEP in control status (0x00), sleep disabled again */
+    err = bms_ic_set_mode(bms.ic_dev, BMS_IC_MODE_STANDBY);
+    zassert_equal(0, err);
+    zassert_equal(0x04, bq769x2_emul_get_direct_mem(bms_ic_emul, 0x00) & 0x04);
+    zassert_equal(0x00, bq769x2_emul_get_direct_mem(bms_ic_emul, 0x12) & 0x04);
+
+    /* wake-up via EXIT_DEEPSLEEP subcommand */
+    err = bms_ic_set_mode(bms.ic_dev, BMS_IC_MODE_ACTIVE);
+    zassert_equal(0, err);
+    zassert_equal(0x00, bq769x2_emul_get_direct_mem(bms_ic_emul, 0x00) & 0x04);
+}
+
 static void *bq769x2_setup(void)
 {
     common_setup_bms_defaults(&bms);
@@ -512,4 +880,45 @@ static void *bq769x2_setup(void)
     return NULL;
 }
 
-ZTEST_SUITE(bq769x2_functions, NULL, bq769x2_setup, NULL, NULL, NULL);
+static void bq769x2_before(void *fixture)
+{
+    /* tests modify the emulated data memory directly, bypassing the driver's RAM shadow */
+    bq769x2_datamem_cache_invalidate(bms.ic_dev);
+}
+
+static K_SEM_DEFINE(data_callback_sem, 0, 1);
+static uint32_t data_callback_flags;
+
+static void data_callback(const struct device *dev, uint32_t flags)
+{
+    data_callback_flags = flags;
+    k_sem_give(&data_callback_sem);
+}
+
+ZTEST(bq769x2_functions, test_alert_triggered_read)
+{
+    const struct gpio_dt_spec alert_gpio = GPIO_DT_SPEC_GET(DT_ALIAS(bms_ic), alert_gpios);
+    int err;
+
+    err = bms_ic_set_data_callback(bms.ic_dev, data_callback);
+    zassert_equal(0, err);
+    zassert_equal(0x80, bq769x2_emul_get_direct_mem(bms_ic_emul, 0x66) & 0x80); // FULLSCAN
+    zassert_equal(0x10, bq769x2_emul_get_direct_mem(bms_ic_emul, 0x67) & 0x10); // MSK_SFALERT
+
+    // safety alert
+    bq769x2_emul_set_direct_mem(bms_ic_emul, 0x63, 0x10);
+    gpio_emul_input_set(alert_gpio.port, alert_gpio.pin, 1);
+
+    err = k_sem_take(&data_callback_sem, K_MSEC(100));
+    zassert_equal(0, err);
+    zassert_equal(BMS_IC_DATA_ERROR_FLAGS, data_callback_flags);
+    zassert_equal(0, bq769x2_emul_get_direct_mem(bms_ic_emul, 0x63)); // cleared
+
+    gpio_emul_input_set(alert_gpio.port, alert_gpio.pin, 0);
+
+    err = bms_ic_set_data_callback(bms.ic_dev, NULL);
+    zassert_equal(0, err);
+    zassert_equal(0, bq769x2_emul_get_direct_mem(bms_ic_emul, 0x66) & 0x80);
+}
+
+ZTEST_SUITE(bq769x2_functions, NULL, bq769x2_setup, bq769x2_before, NULL, NULL);
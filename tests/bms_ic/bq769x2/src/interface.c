@@ -68,6 +68,26 @@ ZTEST(bq769x2_interface, test_bq769x2_direct_read_i2)
     zassert_equal(INT16_MIN, i2);
 }
 
+ZTEST(bq769x2_interface, test_bq769x2_direct_read_block)
+{
+    uint8_t buf[32] = { 0 };
+    int err;
+
+    for (int i = 0; i < sizeof(buf); i++) {
+        bq769x2_emul_set_direct_mem(bms_ic_emul, 0x14 + i, i + 1);
+    }
+
+    err = bq769x2_direct_read_block(bms.ic_dev, 0x14, buf, sizeof(buf));
+    zassert_equal(0, err);
+    for (int i = 0; i < sizeof(buf); i++) {
+        zassert_equal(i + 1, buf[i]);
+    }
+
+    /* more than the maximum block size of 32 bytes */
+    err = bq769x2_direct_read_block(bms.ic_dev, 0x14, buf, sizeof(buf) + 1);
+    zassert_equal(-EINVAL, err);
+}
+
 ZTEST(bq769x2_interface, test_bq769x2_subcmd_cmd_only)
 {
     // reset subcommand
@@ -265,6 +285,49 @@ ZTEST(bq769x2_interface, test_bq769x2_datamem_write_f4)
     bq769x2_config_update_mode(bms.ic_dev, false);
 }
 
+ZTEST(bq769x2_interface, test_bq769x2_datamem_write_block)
+{
+    uint8_t data[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
+    uint8_t chk_expected = (uint8_t) ~(0x91 + 0x80 + 0x01 + 0x02 + 0x03 + 0x04 + 0x05 + 0x06);
+    uint8_t len_expected = 4 + sizeof(data);
+
+    bq769x2_config_update_mode(bms.ic_dev, true);
+
+    int err = bq769x2_datamem_write_block(bms.ic_dev, 0x9180, data, sizeof(data));
+    zassert_equal(0, err);
+
+    for (int i = 0; i < sizeof(data); i++) {
+        zassert_equal(data[i], bq769x2_emul_get_direct_mem(bms_ic_emul, 0x40 + i));
+        zassert_equal(data[i], bq769x2_emul_get_data_mem(bms_ic_emul, 0x9180 + i));
+    }
+    zassert_equal(chk_expected, bq769x2_emul_get_direct_mem(bms_ic_emul, 0x60));
+    zassert_equal(len_expected, bq769x2_emul_get_direct_mem(bms_ic_emul, 0x61));
+
+    // more than 32 bytes are not allowed
+    uint8_t too_long[33] = { 0 };
+    err = bq769x2_datamem_write_block(bms.ic_dev, 0x9180, too_long, sizeof(too_long));
+    zassert_equal(-EINVAL, err);
+
+    bq769x2_config_update_mode(bms.ic_dev, false);
+}
+
+ZTEST(bq769x2_interface, test_bq769x2_wait_stats)
+{
+    struct bq769x2_wait_stats stats;
+    uint16_t u2;
+
+    bq769x2_wait_stats_reset(bms.ic_dev);
+
+    int err = bq769x2_subcmd_read_u2(bms.ic_dev, 0x0001, &u2); // DEVICE_NUMBER
+    zassert_equal(0, err);
+
+    bq769x2_wait_stats_get(bms.ic_dev, &stats);
+    zassert_equal(1, stats.count);
+    zassert_equal(0, stats.timeouts);
+    zassert_true(stats.polls >= 1);
+    zassert_true(stats.max_us <= stats.total_us);
+}
+
 static void *bq769x2_setup(void)
 {
     common_setup_bms_defaults(&bms);
@@ -272,4 +335,10 @@ static void *bq769x2_setup(void)
     return NULL;
 }
 
-ZTEST_SUITE(bq769x2_interface, NULL, bq769x2_setup, NULL, NULL, NULL);
+static void bq769x2_before(void *fixture)
+{
+    /* tests modify the emulated data memory directly, bypassing the driver's RAM shadow */
+    bq769x2_datamem_cache_invalidate(bms.ic_dev);
+}
+
+ZTEST_SUITE(bq769x2_interface, NULL, bq769x2_setup, bq769x2_before, NULL, NULL);
@@ -9,6 +9,9 @@
 #include <zephyr/device.h>
 #include <zephyr/kernel.h>
 
+/* upper limit for activation and the startup benchmark, longer than any IC wake-up delay */
+#define STARTUP_TIMEOUT_MS (10000)
+
 struct bms_context bms = {
     .ic_dev = DEVICE_DT_GET(DT_ALIAS(bms_ic)),
 };
@@ -18,11 +21,42 @@ float OCV[] = { // 100, 95, ..., 0 %
     3.264, 3.262, 3.252, 3.240, 3.226, 3.213, 3.190, 3.177, 3.132, 2.833
 };
 
+static void activate_ic(void)
+{
+    if (bms_ic_set_mode(bms.ic_dev, BMS_IC_MODE_ACTIVE) == -EINPROGRESS) {
+        int64_t start = k_uptime_get();
+        struct bms_ic_status status;
+        while (bms_ic_get_status(bms.ic_dev, &status) == 0 && status.activating
+               && k_uptime_get() - start < STARTUP_TIMEOUT_MS)
+        {
+            k_sleep(K_MSEC(1));
+        }
+    }
+}
+
+int64_t common_startup_time_ms(void)
+{
+    int64_t start = k_uptime_get();
+
+    activate_ic();
+
+    while (bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_CELL_VOLTAGES | BMS_IC_DATA_PACK_VOLTAGES)
+           != 0)
+    {
+        if (k_uptime_get() - start > STARTUP_TIMEOUT_MS) {
+            return -1;
+        }
+        k_sleep(K_MSEC(1));
+    }
+
+    return k_uptime_get() - start;
+}
+
 void common_setup_bms_defaults()
 {
     bms_ic_assign_data(bms.ic_dev, &bms.ic_data);
 
-    bms_ic_set_mode(bms.ic_dev, BMS_IC_MODE_ACTIVE);
+    activate_ic();
 
     bms.ic_conf.dis_sc_limit = 35.0;
     bms.ic_conf.dis_sc_delay_us = 200;
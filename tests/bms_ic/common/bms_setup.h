@@ -7,6 +7,15 @@
 #ifndef TESTS_BMS_IC_COMMON_BMS_SETUP_H_
 #define TESTS_BMS_IC_COMMON_BMS_SETUP_H_
 
+#include <stdint.h>
+
 void common_setup_bms_defaults();
 
+/**
+ * Activate the BMS IC and measure the time until the first valid data could be read.
+ *
+ * @returns Time to first valid data in ms or -1 in case of timeout.
+ */
+int64_t common_startup_time_ms(void);
+
 #endif /* TESTS_BMS_IC_COMMON_BMS_SETUP_H_ */
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "bms_ic_crc.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/ztest.h>
+
+#include <stdio.h>
+
+/* number of data bytes in a typical burst read of bq769x2 */
+#define BENCHMARK_NUM_BYTES  (32)
+#define BENCHMARK_ITERATIONS (1000)
+
+ZTEST(bms_ic_crc, test_check_value)
+{
+    /* check value of CRC-8/SMBUS as specified in the CRC catalogue */
+    const char data[] = "123456789";
+
+    zassert_equal(0xF4, bms_ic_crc8(0, data, sizeof(data) - 1));
+}
+
+ZTEST(bms_ic_crc, test_single_bytes)
+{
+    for (int i = 0; i <= UINT8_MAX; i++) {
+        uint8_t byte = i;
+        zassert_equal(crc8_ccitt(0, &byte, 1), bms_ic_crc8(0, &byte, 1), "byte 0x%02X", byte);
+    }
+}
+
+ZTEST(bms_ic_crc, test_incremental)
+{
+    uint8_t buf[64];
+
+    for (int i = 0; i < sizeof(buf); i++) {
+        buf[i] = i * 37 + 11;
+    }
+
+    uint8_t crc = bms_ic_crc8(0, buf, 10);
+    crc = bms_ic_crc8(crc, buf + 10, sizeof(buf) - 10);
+
+    zassert_equal(crc8_ccitt(0, buf, sizeof(buf)), crc);
+    zassert_equal(crc8_ccitt(0, buf, sizeof(buf)), bms_ic_crc8(0, buf, sizeof(buf)));
+}
+
+/*
+ * Verify the CRC of each data byte separately, as it is done for burst reads from bq769x2 and
+ * bq769x0 ICs.
+ */
+static uint32_t benchmark_cycles(uint8_t (*crc8_fn)(uint8_t, const void *, size_t),
+                                 const uint8_t *buf)
+{
+    volatile uint8_t errors = 0;
+
+    uint32_t start = k_cycle_get_32();
+
+    for (int n = 0; n < BENCHMARK_ITERATIONS; n++) {
+        for (int i = 0; i < BENCHMARK_NUM_BYTES; i++) {
+            if (crc8_fn(0, &buf[2 * i], 1) != buf[2 * i + 1]) {
+                errors++;
+            }
+        }
+    }
+
+    uint32_t cycles = k_cycle_get_32() - start;
+
+    zassert_equal(0, errors);
+
+    return cycles;
+}
+
+ZTEST(bms_ic_crc, test_benchmark)
+{
+    uint8_t buf[BENCHMARK_NUM_BYTES * 2];
+    uint32_t cycles_zephyr, cycles_bms_ic;
+
+    /* data bytes interleaved with their CRC as received from the bus */
+    for (int i = 0; i < BENCHMARK_NUM_BYTES; i++) {
+        buf[2 * i] = i * 37 + 11;
+        buf[2 * i + 1] = crc8_ccitt(0, &buf[2 * i], 1);
+    }
+
+    cycles_zephyr = benchmark_cycles(crc8_ccitt, buf);
+    cycles_bms_ic = benchmark_cycles(bms_ic_crc8, buf);
+
+    /*
+     * Attention: On native_sim the cycle counter is derived from the simulated time, so the
+     * results are only meaningful if the test is run on actual hardware.
+     */
+    TC_PRINT("CRC-8 cycles per verified byte (x100): crc8_ccitt: %u, bms_ic_crc8: %u\n",
+             cycles_zephyr * 100U / (BENCHMARK_ITERATIONS * BENCHMARK_NUM_BYTES),
+             cycles_bms_ic * 100U / (BENCHMARK_ITERATIONS * BENCHMARK_NUM_BYTES));
+}
+
+ZTEST_SUITE(bms_ic_crc, NULL, NULL, NULL, NULL, NULL);
@@ -73,6 +73,22 @@ ZTEST(isl94202, test_isl94202_read_min_max_avg_voltage)
     zassert_equal(3.35F, roundf(bms.ic_data.cell_voltage_avg * 100) / 100);
 }
 
+ZTEST(isl94202, test_isl94202_read_all_data)
+{
+    isl94202_emul_set_mem_defaults(bms_ic_emul);
+    isl94202_emul_set_word(bms_ic_emul, 0xA2, 0.463F * 2 / 1.8F * 4095); // 25°C
+    isl94202_emul_set_word(bms_ic_emul, 0xA4, 0.463F * 2 / 1.8F * 4095); // 25°C
+
+    /* all measurements are decoded from a single burst read of the RAM registers */
+    int err = bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_ALL);
+    zassert_equal(0, err);
+
+    zassert_equal(3.0F, roundf(bms.ic_data.cell_voltages[0] * 100) / 100);
+    zassert_equal(3.7F, roundf(bms.ic_data.cell_voltages[7] * 100) / 100);
+    zassert_equal(25.0F, roundf(bms.ic_data.cell_temp_avg * 10) / 10);
+    zassert_equal(25.0F, roundf(bms.ic_data.mosfet_temp * 10) / 10);
+}
+
 ZTEST(isl94202, test_isl94202_read_current)
 {
     isl94202_emul_set_mem_defaults(bms_ic_emul);
@@ -357,6 +373,245 @@ ZTEST(isl94202, test_isl94202_apply_dis_ut_limit)
     zassert_equal(0x0BBD, isl94202_emul_get_word(bms_ic_emul, 0x3E)); // datasheet: 0x0A93
 }
 
+ZTEST(isl94202, test_isl94202_config_shadow)
+{
+    int err;
+
+    bms.ic_conf.cell_ov_limit = 3.65F;
+    err = bms_ic_configure(bms.ic_dev, &bms.ic_conf, BMS_IC_CONF_VOLTAGE_LIMITS);
+    zassert_equal(BMS_IC_CONF_VOLTAGE_LIMITS, err);
+    uint16_t ovl_reg = isl94202_emul_get_word(bms_ic_emul, 0x00);
+
+    /* change register without the driver noticing it */
+    isl94202_emul_set_word(bms_ic_emul, 0x00, 0);
+
+    /* unchanged configuration must not be written again */
+    err = bms_ic_configure(bms.ic_dev, &bms.ic_conf, BMS_IC_CONF_VOLTAGE_LIMITS);
+    zassert_equal(BMS_IC_CONF_VOLTAGE_LIMITS, err);
+    zassert_equal(0, isl94202_emul_get_word(bms_ic_emul, 0x00));
+
+    /* shadow is reloaded from the IC after activation */
+    err = bms_ic_set_mode(bms.ic_dev, BMS_IC_MODE_ACTIVE);
+    zassert_equal(0, err);
+    err = bms_ic_configure(bms.ic_dev, &bms.ic_conf, BMS_IC_CONF_VOLTAGE_LIMITS);
+    zassert_equal(BMS_IC_CONF_VOLTAGE_LIMITS, err);
+    zassert_equal(ovl_reg, isl94202_emul_get_word(bms_ic_emul, 0x00));
+}
+
+#ifdef CONFIG_BMS_IC_ISL94202_SW_BALANCING
+
+ZTEST(isl94202, test_isl94202_sw_balancing_conditions)
+{
+    isl94202_emul_set_mem_defaults(bms_ic_emul);
+    isl94202_emul_set_byte(bms_ic_emul, 0x84, 0x00);                      // CBFC
+    isl94202_emul_set_word(bms_ic_emul, 0xA2, 0.463F * 2 / 1.8F * 4095); // 25°C
+
+    // charging with 10 A, gain 50
+    isl94202_emul_set_byte(bms_ic_emul, 0x82, 0x01U << 2); // CHING
+    isl94202_emul_set_byte(bms_ic_emul, 0x85, 0x00U);
+    isl94202_emul_set_word(bms_ic_emul, 0x8E, 10.0F / 1.8F * 4095 * 50 * shunt_res_mohm / 1000);
+
+    bms.ic_conf.bal_idle_current = 0.1F;
+    bms.ic_conf.bal_idle_delay = 1;
+    bms.ic_conf.auto_balancing = true;
+    bms_ic_configure(bms.ic_dev, &bms.ic_conf, BMS_IC_CONF_BALANCING | BMS_IC_CONF_TEMP_LIMITS);
+
+    /* cell voltages are above the limits, but the battery is not idle */
+    bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_ALL);
+    k_sleep(K_MSEC(100));
+    zassert_equal(0, isl94202_emul_get_byte(bms_ic_emul, 0x84));
+
+    /* idle, but not long enough */
+    isl94202_emul_set_byte(bms_ic_emul, 0x82, 0x00U);
+    isl94202_emul_set_word(bms_ic_emul, 0x8E, 0);
+    bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_ALL);
+    k_sleep(K_MSEC(100));
+    zassert_equal(0, isl94202_emul_get_byte(bms_ic_emul, 0x84));
+
+    k_sleep(K_MSEC(1000));
+    bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_ALL);
+    k_sleep(K_MSEC(100));
+    zassert_not_equal(0, isl94202_emul_get_byte(bms_ic_emul, 0x84));
+
+    /* balancing stopped above the charge temperature limit */
+    isl94202_emul_set_word(bms_ic_emul, 0xA2, 0.150F * 2 / 1.8F * 4095); // >80°C
+    bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_ALL);
+    k_sleep(K_MSEC(100));
+    zassert_equal(0, isl94202_emul_get_byte(bms_ic_emul, 0x84));
+
+    isl94202_emul_set_word(bms_ic_emul, 0xA2, 0.463F * 2 / 1.8F * 4095);
+    bms.ic_conf.auto_balancing = false;
+    bms_ic_configure(bms.ic_dev, &bms.ic_conf, BMS_IC_CONF_BALANCING);
+}
+
+#else
+
+ZTEST(isl94202, test_isl94202_balancing_timing_events)
+{
+    struct bms_ic_status status;
+    uint32_t skipped;
+
+    /* NORMAL mode */
+    isl94202_emul_set_byte(bms_ic_emul, 0x83, 0x00);
+
+    bms.ic_conf.auto_balancing = true;
+    bms_ic_configure(bms.ic_dev, &bms.ic_conf, BMS_IC_CONF_BALANCING);
+    k_sleep(K_MSEC(500));
+    zassert_equal(16 | (1U << 10), isl94202_emul_get_word(bms_ic_emul, 0x24)); // CBONT
+
+    bms_ic_get_status(bms.ic_dev, &status);
+    skipped = status.skipped_transfers;
+
+    /* no bus transfers for the balancing timing as long as the mode does not change */
+    bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_ERROR_FLAGS);
+    bms_ic_get_status(bms.ic_dev, &status);
+    zassert_equal(skipped, status.skipped_transfers);
+
+    /* only the STAT3 reads of the former 1 s polling are counted as skipped */
+    k_sleep(K_MSEC(3000));
+    bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_ERROR_FLAGS);
+    bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_ERROR_FLAGS);
+    bms_ic_get_status(bms.ic_dev, &status);
+    zassert_equal(skipped + 3, status.skipped_transfers);
+
+    /* IDLE mode is detected with the next data read */
+    isl94202_emul_set_byte(bms_ic_emul, 0x83, 0x01U << 4);
+    bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_ERROR_FLAGS);
+    k_sleep(K_MSEC(500));
+    zassert_equal(240 | (1U << 10), isl94202_emul_get_word(bms_ic_emul, 0x24));
+
+    isl94202_emul_set_byte(bms_ic_emul, 0x83, 0x00);
+    bms.ic_conf.auto_balancing = false;
+    bms_ic_configure(bms.ic_dev, &bms.ic_conf, BMS_IC_CONF_BALANCING);
+}
+
+#endif /* CONFIG_BMS_IC_ISL94202_SW_BALANCING */
+
+ZTEST(isl94202, test_isl94202_snapshot)
+{
+    struct bms_ic_snapshot snap1, snap2;
+    int err;
+
+    isl94202_emul_set_mem_defaults(bms_ic_emul);
+
+    bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_CELL_VOLTAGES | BMS_IC_DATA_PACK_VOLTAGES);
+    err = bms_ic_get_snapshot(bms.ic_dev, &snap1);
+    zassert_equal(0, err);
+    zassert_equal(3.0F, roundf(snap1.data.cell_voltages[0] * 100) / 100);
+    zassert_equal(bms.ic_data.total_voltage, snap1.data.total_voltage);
+
+    k_sleep(K_MSEC(10));
+
+    bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_ERROR_FLAGS);
+    err = bms_ic_get_snapshot(bms.ic_dev, &snap2);
+    zassert_equal(0, err);
+    zassert_equal(snap1.seq + 1, snap2.seq);
+
+    /* only the timestamps of the updated groups are changed */
+    zassert_equal(snap1.timestamps[0], snap2.timestamps[0]); // BMS_IC_DATA_CELL_VOLTAGES
+    zassert_true(snap2.timestamps[5] > snap1.timestamps[0]); // BMS_IC_DATA_ERROR_FLAGS
+}
+
+ZTEST(isl94202, test_isl94202_read_data_async)
+{
+    struct k_poll_signal signal;
+    struct k_poll_event event =
+        K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &signal);
+    unsigned int signaled;
+    int result;
+    int err;
+
+    isl94202_emul_set_mem_defaults(bms_ic_emul);
+    bms.ic_data.cell_voltages[0] = 0.0F;
+    k_poll_signal_init(&signal);
+
+    err = bms_ic_read_data_async(bms.ic_dev, BMS_IC_DATA_CELL_VOLTAGES, &signal);
+    zassert_equal(0, err);
+
+    err = k_poll(&event, 1, K_MSEC(100));
+    zassert_equal(0, err);
+    k_poll_signal_check(&signal, &signaled, &result);
+    zassert_true(signaled);
+    zassert_equal(0, result);
+    zassert_equal(3.0F, roundf(bms.ic_data.cell_voltages[0] * 100) / 100);
+}
+
+ZTEST(isl94202, test_isl94202_read_data_async_busy)
+{
+    struct k_poll_signal signal;
+    struct k_poll_event event =
+        K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &signal);
+    int err;
+
+    k_poll_signal_init(&signal);
+
+    /* the system work queue can't process the first request before the scheduler is unlocked */
+    k_sched_lock();
+    err = bms_ic_read_data_async(bms.ic_dev, BMS_IC_DATA_CELL_VOLTAGES, &signal);
+    zassert_equal(0, err);
+    err = bms_ic_read_data_async(bms.ic_dev, BMS_IC_DATA_CELL_VOLTAGES, &signal);
+    k_sched_unlock();
+    zassert_equal(-EBUSY, err);
+
+    err = k_poll(&event, 1, K_MSEC(100));
+    zassert_equal(0, err);
+
+    /* accepted again after completion */
+    k_poll_signal_reset(&signal);
+    event.state = K_POLL_STATE_NOT_READY;
+    err = bms_ic_read_data_async(bms.ic_dev, BMS_IC_DATA_CELL_VOLTAGES, &signal);
+    zassert_equal(0, err);
+    err = k_poll(&event, 1, K_MSEC(100));
+    zassert_equal(0, err);
+}
+
+ZTEST(isl94202, test_isl94202_activation_waits_for_scan)
+{
+    int64_t start = k_uptime_get();
+    int err;
+
+    isl94202_emul_set_byte(bms_ic_emul, 0x87, 0x00); // CTRL2
+    isl94202_emul_wake_up(bms_ic_emul, 100);
+
+    err = bms_ic_set_mode(bms.ic_dev, BMS_IC_MODE_ACTIVE);
+    zassert_equal(0, err);
+
+    /* not configured before the IC responds and the first scan after wake-up is finished */
+    zassert_true(k_uptime_get() - start > 100);
+    zassert_equal(0x01U << 6, isl94202_emul_get_byte(bms_ic_emul, 0x87) & (0x01U << 6)); // UCFET
+
+    err = bms_ic_read_data(bms.ic_dev, BMS_IC_DATA_PACK_VOLTAGES);
+    zassert_equal(0, err);
+}
+
+ZTEST(isl94202, test_isl94202_startup_time)
+{
+    /* emulated wake-up delay (datasheet: up to 3 s from shutdown or initial power-up) */
+    isl94202_emul_wake_up(bms_ic_emul, 300);
+
+    int64_t startup_ms = common_startup_time_ms();
+
+    TC_PRINT("ISL94202 time to first valid data: %lld ms\n", (long long)startup_ms);
+
+    /* data can't be valid before the IC woke up */
+    zassert_true(startup_ms >= 300);
+}
+
+ZTEST(isl94202, test_isl94202_activation_timeout)
+{
+    int err;
+
+    isl94202_emul_wake_up(bms_ic_emul, CONFIG_BMS_IC_ISL94202_STARTUP_TIMEOUT_MS + 100);
+
+    err = bms_ic_set_mode(bms.ic_dev, BMS_IC_MODE_ACTIVE);
+    zassert_equal(-ETIMEDOUT, err);
+
+    /* activation succeeds once the IC finally woke up */
+    k_sleep(K_MSEC(100));
+    err = bms_ic_set_mode(bms.ic_dev, BMS_IC_MODE_ACTIVE);
+    zassert_equal(0, err);
+}
+
 static void *isl94202_setup(void)
 {
     common_setup_bms_defaults();
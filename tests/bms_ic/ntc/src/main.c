@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "bms_ic_ntc.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <math.h>
+#include <stdio.h>
+
+/* bq769x0 TS ADC: 382 uV/LSB with 10k pull-up to 3.3 V */
+#define ADC_FULL_SCALE (3300.0F / 0.382F)
+
+#define BENCHMARK_ITERATIONS (100)
+
+static const uint16_t betas[] = { 3435, 3950, 4250 };
+
+/* Beta equation as used by the bq769x0 driver before the introduction of the lookup table */
+static float reference_temp(uint16_t adc, uint16_t beta)
+{
+    float vts = adc * 0.382F;                     /* mV */
+    float rts = 10000.0F * vts / (3300.0F - vts); /* Ohm */
+
+    return 1.0F / (1.0F / (273.15F + 25) + 1.0F / beta * logf(rts / 10000.0F)) - 273.15F;
+}
+
+static uint16_t reference_adc(float temp, uint16_t beta)
+{
+    float r_ratio = expf(beta * (1.0F / (temp + 273.15F) - 1.0F / (273.15F + 25)));
+
+    return lroundf(ADC_FULL_SCALE * r_ratio / (1.0F + r_ratio));
+}
+
+ZTEST(bms_ic_ntc, test_table_points)
+{
+    struct bms_ic_ntc_table table;
+
+    bms_ic_ntc_table_init(&table, 3435, ADC_FULL_SCALE);
+
+    for (int i = 0; i < BMS_IC_NTC_TABLE_SIZE; i++) {
+        int16_t temp = (BMS_IC_NTC_TEMP_MIN + i * BMS_IC_NTC_TEMP_STEP) * 10;
+        zassert_equal(temp, bms_ic_ntc_temp(&table, table.adc[i]), "point %d", i);
+        if (i > 0) {
+            zassert_true(table.adc[i] < table.adc[i - 1], "point %d", i);
+        }
+    }
+
+    /* 10k at 25 °C with 10k pull-up results in half of the full scale */
+    zassert_within(ADC_FULL_SCALE / 2, table.adc[(25 - BMS_IC_NTC_TEMP_MIN) / 5], 1);
+}
+
+ZTEST(bms_ic_ntc, test_vs_reference)
+{
+    struct bms_ic_ntc_table table;
+
+    for (int b = 0; b < ARRAY_SIZE(betas); b++) {
+        bms_ic_ntc_table_init(&table, betas[b], ADC_FULL_SCALE);
+
+        for (float temp = -40.0F; temp <= 120.0F; temp += 0.25F) {
+            uint16_t adc = reference_adc(temp, betas[b]);
+            float ref = reference_temp(adc, betas[b]);
+            float lut = bms_ic_ntc_temp(&table, adc) * 0.1F;
+
+            zassert_within(ref, lut, 0.4F, "beta %d, %.2f °C: LUT %.2f °C, reference %.2f °C",
+                           betas[b], (double)temp, (double)lut, (double)ref);
+        }
+    }
+}
+
+ZTEST(bms_ic_ntc, test_out_of_range)
+{
+    struct bms_ic_ntc_table table;
+
+    bms_ic_ntc_table_init(&table, 3435, ADC_FULL_SCALE);
+
+    /* open thermistor (ADC at pull-up voltage) and short circuit */
+    zassert_equal(BMS_IC_NTC_TEMP_MIN * 10, bms_ic_ntc_temp(&table, 0x3FFF));
+    zassert_equal(BMS_IC_NTC_TEMP_MAX * 10, bms_ic_ntc_temp(&table, 0));
+}
+
+ZTEST(bms_ic_ntc, test_benchmark)
+{
+    struct bms_ic_ntc_table table;
+    uint16_t adc_min, adc_max;
+    volatile float sum_ref = 0;
+    volatile int32_t sum_lut = 0;
+    uint32_t start, cycles_ref, cycles_lut;
+    int num_conversions;
+
+    bms_ic_ntc_table_init(&table, 3435, ADC_FULL_SCALE);
+    adc_min = table.adc[BMS_IC_NTC_TABLE_SIZE - 1];
+    adc_max = table.adc[0];
+    num_conversions = BENCHMARK_ITERATIONS * (adc_max - adc_min) / 64;
+
+    start = k_cycle_get_32();
+    for (int n = 0; n < BENCHMARK_ITERATIONS; n++) {
+        for (uint16_t adc = adc_min; adc < adc_max; adc += 64) {
+            sum_ref += reference_temp(adc, 3435);
+        }
+    }
+    cycles_ref = k_cycle_get_32() - start;
+
+    start = k_cycle_get_32();
+    for (int n = 0; n < BENCHMARK_ITERATIONS; n++) {
+        for (uint16_t adc = adc_min; adc < adc_max; adc += 64) {
+            sum_lut += bms_ic_ntc_temp(&table, adc);
+        }
+    }
+    cycles_lut = k_cycle_get_32() - start;
+
+    zassert_within(sum_ref, sum_lut * 0.1F, num_conversions * 0.4F);
+
+    /*
+     * Attention: On native_sim the cycle counter is derived from the simulated time, so the
+     * results are only meaningful if the test is run on actual hardware.
+     */
+    TC_PRINT("NTC cycles per conversion (x100): Beta equation: %u, lookup table: %u\n",
+             cycles_ref * 100U / num_conversions, cycles_lut * 100U / num_conversions);
+}
+
+ZTEST_SUITE(bms_ic_ntc, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "bms_ic_samples.h"
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define BUF_SIZE CONFIG_BMS_IC_CURRENT_SAMPLES_BUF_SIZE
+
+static struct bms_ic_samples samples;
+
+static void put_samples(int first, int num)
+{
+    for (int i = first; i < first + num; i++) {
+        struct bms_ic_current_sample sample = { .timestamp = i * 250, .current = i };
+        zassert_true(bms_ic_samples_put(&samples, &sample));
+    }
+}
+
+static void check_samples(int first, int num)
+{
+    struct bms_ic_current_sample out[BUF_SIZE];
+
+    zassert_equal(num, bms_ic_samples_get(&samples, out, ARRAY_SIZE(out)));
+    for (int i = 0; i < num; i++) {
+        zassert_equal((first + i) * 250, out[i].timestamp);
+        zassert_equal(first + i, out[i].current);
+    }
+}
+
+ZTEST(samples, test_empty)
+{
+    struct bms_ic_current_sample out[BUF_SIZE];
+
+    zassert_equal(0, bms_ic_samples_get(&samples, out, ARRAY_SIZE(out)));
+}
+
+ZTEST(samples, test_oldest_first)
+{
+    struct bms_ic_current_sample out[BUF_SIZE];
+
+    put_samples(0, 3);
+
+    /* partial read leaves the remaining samples in the buffer */
+    zassert_equal(2, bms_ic_samples_get(&samples, out, 2));
+    zassert_equal(0, out[0].timestamp);
+    zassert_equal(250, out[1].timestamp);
+
+    check_samples(2, 1);
+}
+
+ZTEST(samples, test_full_buffer)
+{
+    struct bms_ic_current_sample sample = { .timestamp = 1, .current = 1.0F };
+
+    put_samples(0, BUF_SIZE);
+
+    /* new samples are dropped instead of overwriting samples not read by the consumer yet */
+    zassert_false(bms_ic_samples_put(&samples, &sample));
+
+    check_samples(0, BUF_SIZE);
+
+    /* space is available again after reading */
+    zassert_true(bms_ic_samples_put(&samples, &sample));
+    zassert_equal(1, bms_ic_samples_get(&samples, &sample, 1));
+}
+
+ZTEST(samples, test_wrap_around)
+{
+    /* buffer index wraps around several times */
+    for (int i = 0; i < 5 * BUF_SIZE; i += BUF_SIZE - 1) {
+        put_samples(i, BUF_SIZE - 1);
+        check_samples(i, BUF_SIZE - 1);
+    }
+
+    /* free-running counters overflow */
+    atomic_set(&samples.head, -2);
+    atomic_set(&samples.tail, -2);
+
+    put_samples(0, BUF_SIZE);
+    check_samples(0, BUF_SIZE);
+    zassert_equal(BUF_SIZE - 2, atomic_get(&samples.head));
+}
+
+static void samples_before(void *fixture)
+{
+    memset(&samples, 0, sizeof(samples));
+}
+
+ZTEST_SUITE(samples, NULL, NULL, samples_before, NULL, NULL);
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) The Libre Solar Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "bms_ic_sw_protection.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define DELAY_MS    (1000)
+#define RECOVERY_MS (60000)
+
+/* measurements every 250 ms like the bq769x0 coulomb counter */
+#define SAMPLE_MS (250)
+
+ZTEST(sw_protection, test_short_spikes_ignored)
+{
+    struct bms_ic_sw_protection prot = { 0 };
+    int64_t now = 0;
+
+    for (int i = 0; i < 10; i++) {
+        zassert_false(bms_ic_sw_protection_update(&prot, true, DELAY_MS, RECOVERY_MS, now));
+        now += SAMPLE_MS;
+        zassert_false(bms_ic_sw_protection_update(&prot, false, DELAY_MS, RECOVERY_MS, now));
+        now += SAMPLE_MS;
+    }
+
+    zassert_false(prot.tripped);
+}
+
+ZTEST(sw_protection, test_trip_latch_recovery)
+{
+    struct bms_ic_sw_protection prot = { 0 };
+    int64_t now = 0;
+    int trips = 0;
+
+    /* trips once after the delay */
+    for (; now <= DELAY_MS; now += SAMPLE_MS) {
+        trips += bms_ic_sw_protection_update(&prot, true, DELAY_MS, RECOVERY_MS, now) ? 1 : 0;
+    }
+    zassert_equal(1, trips);
+    zassert_true(prot.tripped);
+
+    /* stays latched although the current dropped to 0 after switching off */
+    int64_t tripped_at = DELAY_MS;
+    for (; now < tripped_at + RECOVERY_MS; now += SAMPLE_MS) {
+        zassert_false(bms_ic_sw_protection_update(&prot, false, DELAY_MS, RECOVERY_MS, now));
+        zassert_true(prot.tripped, "recovered after %lld ms", now - tripped_at);
+    }
+
+    /* recovers after the recovery delay */
+    bms_ic_sw_protection_update(&prot, false, DELAY_MS, RECOVERY_MS, now);
+    zassert_false(prot.tripped);
+}
+
+ZTEST(sw_protection, test_no_recovery_while_exceeded)
+{
+    struct bms_ic_sw_protection prot = { 0 };
+    int64_t now = 0;
+
+    for (; now <= DELAY_MS + RECOVERY_MS * 2; now += SAMPLE_MS) {
+        bms_ic_sw_protection_update(&prot, true, DELAY_MS, RECOVERY_MS, now);
+    }
+    zassert_true(prot.tripped);
+
+    bms_ic_sw_protection_update(&prot, false, DELAY_MS, RECOVERY_MS, now);
+    zassert_false(prot.tripped);
+}
+
+ZTEST(sw_protection, test_explicit_reset)
+{
+    struct bms_ic_sw_protection prot = { 0 };
+
+    bms_ic_sw_protection_update(&prot, true, 0, RECOVERY_MS, 0);
+    zassert_true(prot.tripped);
+
+    bms_ic_sw_protection_reset(&prot);
+    zassert_false(prot.tripped);
+
+    /* debouncing starts again */
+    zassert_false(bms_ic_sw_protection_update(&prot, true, DELAY_MS, RECOVERY_MS, 100));
+    zassert_true(bms_ic_sw_protection_update(&prot, true, DELAY_MS, RECOVERY_MS, 100 + DELAY_MS));
+}
+
+ZTEST_SUITE(sw_protection, NULL, NULL, NULL, NULL, NULL);